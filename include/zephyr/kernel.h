@@ -879,6 +879,24 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
 #endif
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the timeout slack of a thread
+ *
+ * The timeouts the thread waits with, such as those of k_sleep() or of
+ * taking a semaphore, may then expire up to @a slack late, so that the
+ * system wakes up once for them and the other timeouts expiring around
+ * the same time.
+ *
+ * @note You should enable @kconfig{CONFIG_TIMEOUT_SLACK} in your project
+ * configuration.
+ *
+ * @param thread Thread whose timeout slack is to be set
+ * @param slack Slack, or @ref K_NO_WAIT for none (the default)
+ */
+__syscall void k_thread_timeout_slack_set(k_tid_t thread, k_timeout_t slack);
+#endif
+
 #ifdef CONFIG_SCHED_CPU_MASK
 /**
  * @brief Sets all CPU enable masks to zero
@@ -1700,6 +1718,46 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
 	return timer->user_data;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+
+/**
+ * @brief Set the slack of a timer.
+ *
+ * The timer may then expire up to @a slack later than its duration or
+ * period, so that the system wakes up once for it and the other timeouts
+ * expiring around the same time. The delay doesn't accumulate over the
+ * periods of a periodic timer.
+ *
+ * @note You should enable @kconfig{CONFIG_TIMEOUT_SLACK} in your project
+ * configuration.
+ *
+ * @param timer Address of timer.
+ * @param slack Slack, or @ref K_NO_WAIT for none (the default).
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_timeout_t slack);
+
+/** @brief Timeout slack statistics. */
+struct k_timeout_slack_stats {
+	/** Number of system timer wakeups that expired timeouts. */
+	uint32_t wakeups;
+	/** Number of wakeups avoided by delaying timeouts within their slack. */
+	uint32_t wakeups_saved;
+};
+
+/**
+ * @brief Get the timeout slack statistics.
+ *
+ * @param stats Statistics since boot or the last reset.
+ */
+void k_timeout_slack_stats_get(struct k_timeout_slack_stats *stats);
+
+/**
+ * @brief Reset the timeout slack statistics.
+ */
+void k_timeout_slack_stats_reset(void);
+
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /** @} */
 
 /**
@@ -1911,6 +1969,28 @@ extern void k_queue_append(struct k_queue *queue, void *data);
  */
 __syscall int32_t k_queue_alloc_append(struct k_queue *queue, void *data);
 
+/**
+ * @brief Append several elements to a queue.
+ *
+ * This routine appends the data items in @a data to @a queue in order,
+ * under a single lock and with one scheduling pass. As with
+ * k_queue_alloc_append(), the bookkeeping for each queued item is
+ * allocated from the calling thread's resource pool, so this routine
+ * can be used from user mode.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param data Array of addresses of the data items.
+ * @param num_items Number of data items in @a data.
+ *
+ * @return Number of data items appended. If it is less than @a num_items,
+ *         the caller's resource pool ran out of memory.
+ * @retval -ENOMEM if no data item could be appended
+ */
+__syscall int32_t k_queue_alloc_append_many(struct k_queue *queue, void **data,
+					    uint32_t num_items);
+
 /**
  * @brief Prepend an element to a queue.
  *
@@ -2015,6 +2095,31 @@ extern int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, k_timeout_t timeout);
 
+/**
+ * @brief Get several elements from a queue.
+ *
+ * This routine removes up to @a max_items data items from @a queue under a
+ * single lock and stores their addresses in @a data. If the queue is
+ * empty, it waits like k_queue_get() for the first data item and then
+ * also takes any others that are queued, without waiting for more.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param data Array to hold the addresses of up to @a max_items data items.
+ * @param max_items Maximum number of data items to get.
+ * @param timeout Non-negative waiting period to obtain the first data item
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of data items obtained; 0 if returned without waiting,
+ * the waiting period timed out or the wait was cancelled.
+ */
+__syscall int k_queue_get_many(struct k_queue *queue, void **data,
+			       uint32_t max_items, k_timeout_t timeout);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -2454,6 +2559,25 @@ struct k_fifo {
 	ret; \
 	})
 
+/**
+ * @brief Add several elements to a FIFO queue.
+ *
+ * This routine adds the data items in @a data to @a fifo in order, in one
+ * operation. Like k_fifo_alloc_put(), it allocates the bookkeeping for
+ * each item from the calling thread's resource pool.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param fifo Address of the FIFO.
+ * @param data Array of addresses of the data items.
+ * @param num_items Number of data items in @a data.
+ *
+ * @return Number of data items added
+ * @retval -ENOMEM if no data item could be added
+ */
+#define k_fifo_alloc_put_many(fifo, data, num_items) \
+	k_queue_alloc_append_many(&(fifo)->_queue, data, num_items)
+
 /**
  * @brief Atomically add a list of elements to a FIFO.
  *
@@ -2520,6 +2644,28 @@ struct k_fifo {
 	ret; \
 	})
 
+/**
+ * @brief Get several elements from a FIFO queue.
+ *
+ * This routine removes up to @a max_items data items from @a fifo in one
+ * operation, waiting only for the first one.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param fifo Address of the FIFO queue.
+ * @param data Array to hold the addresses of up to @a max_items data items.
+ * @param max_items Maximum number of data items to get.
+ * @param timeout Waiting period to obtain the first data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items obtained; 0 if returned without waiting,
+ * or waiting period timed out.
+ */
+#define k_fifo_get_many(fifo, data, max_items, timeout) \
+	k_queue_get_many(&(fifo)->_queue, data, max_items, timeout)
+
 /**
  * @brief Query a FIFO queue to see if it has data available.
  *
@@ -2853,6 +2999,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 struct k_work;
 struct k_work_q;
 struct k_work_queue_config;
+struct k_work_queue_worker;
 extern struct k_work_q k_sys_work_q;
 
 /**
@@ -2865,6 +3012,21 @@ extern struct k_work_q k_sys_work_q;
  * @{
  */
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/**
+ * Mutex contention statistics
+ * @ingroup mutex_apis
+ */
+struct k_mutex_spin_stats {
+	/** Number of times a thread spun on the mutex */
+	uint32_t spins;
+	/** Number of times a thread took the mutex after spinning */
+	uint32_t spin_acquired;
+	/** Number of times a thread pended on the mutex */
+	uint32_t sleeps;
+};
+#endif
+
 /**
  * Mutex Structure
  * @ingroup mutex_apis
@@ -2881,6 +3043,11 @@ struct k_mutex {
 	/** Original thread priority */
 	int owner_orig_prio;
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	/** Contention statistics */
+	struct k_mutex_spin_stats spin_stats;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mutex)
 };
 
@@ -2972,6 +3139,36 @@ __syscall int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
  */
 __syscall int k_mutex_unlock(struct k_mutex *mutex);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/**
+ * @brief Get the contention statistics of a mutex.
+ *
+ * @note You should enable @kconfig{CONFIG_MUTEX_ADAPTIVE_SPIN} in your
+ * project configuration.
+ *
+ * @param mutex Address of the mutex.
+ * @param stats Statistics since the mutex was initialized or last reset.
+ *
+ * @retval 0 Statistics copied
+ * @retval -EINVAL Invalid argument
+ */
+int k_mutex_spin_stats_get(struct k_mutex *mutex,
+			   struct k_mutex_spin_stats *stats);
+
+/**
+ * @brief Reset the contention statistics of a mutex.
+ *
+ * @note You should enable @kconfig{CONFIG_MUTEX_ADAPTIVE_SPIN} in your
+ * project configuration.
+ *
+ * @param mutex Address of the mutex.
+ *
+ * @retval 0 Statistics reset
+ * @retval -EINVAL Invalid argument
+ */
+int k_mutex_spin_stats_reset(struct k_mutex *mutex);
+#endif
+
 /**
  * @}
  */
@@ -3416,6 +3613,42 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+/** @brief Add a worker thread to a work queue.
+ *
+ * This creates and starts another thread that processes the items of
+ * @p queue, with the priority of the queue thread.  Work items submitted
+ * by a worker thread, or from the CPU a worker is pinned to, go to that
+ * worker's own list; other submissions go to the list of the queue
+ * thread.  A thread that runs out of work takes the oldest item from the
+ * lists of the others.
+ *
+ * A work item never runs on two threads at once: if it is submitted
+ * while running, it is run again by the same thread once it completes.
+ * Flushing, cancelling and draining behave as on a single-thread queue,
+ * but different work items of the queue may now run concurrently.
+ *
+ * Worker threads cannot be removed.  The first worker must be added
+ * before any work is submitted to the queue.
+ *
+ * @note Requires CONFIG_WORKQUEUE_WORKERS.
+ *
+ * @param queue pointer to a started work queue.
+ *
+ * @param worker pointer to the worker structure, which must stay valid as
+ *        long as the queue is in use.
+ *
+ * @param stack pointer to the worker thread stack area.
+ *
+ * @param stack_size size of the worker thread stack area, in bytes.
+ *
+ * @param cpu the CPU to pin the worker thread to, or -1 to let it run on
+ *        any CPU.  Pinning requires CONFIG_SCHED_CPU_MASK.
+ */
+void k_work_queue_add_worker(struct k_work_q *queue,
+			     struct k_work_queue_worker *worker,
+			     k_thread_stack_t *stack, size_t stack_size,
+			     int cpu);
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -3483,6 +3716,26 @@ int k_work_queue_unplug(struct k_work_q *queue);
 void k_work_init_delayable(struct k_work_delayable *dwork,
 			   k_work_handler_t handler);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/** @brief Set the slack of a delayable work item.
+ *
+ * The work item may then be submitted up to @p slack later than its delay,
+ * so that the system wakes up once for it and the other timeouts expiring
+ * around the same time.
+ *
+ * @note You should enable @kconfig{CONFIG_TIMEOUT_SLACK} in your project
+ * configuration.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param slack the slack, or @c K_NO_WAIT for none (the default).
+ */
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /**
  * @brief Get the parent delayable work structure from a work pointer.
  *
@@ -3892,6 +4145,14 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	/* On queues with worker threads the flusher is not queued.  It
+	 * waits in a global list of pending flushes, linked through
+	 * work.node, until the flushed item has completed this many runs.
+	 */
+	struct k_work *target;
+	uint32_t runs;
+#endif
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -3978,6 +4239,36 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	/* Additional threads added by k_work_queue_add_worker(). */
+	sys_slist_t workers;
+
+	/* Number of work items being run by the queue's threads. */
+	uint32_t running;
+#endif
+};
+
+/** @brief An additional thread processing the items of a work queue.
+ *
+ * See k_work_queue_add_worker().
+ */
+struct k_work_queue_worker {
+	/* The worker thread. */
+	struct k_thread thread;
+
+	/* All the following fields must be accessed only while the
+	 * work module spinlock is held.
+	 */
+
+	/* Node in the list of workers of the queue. */
+	sys_snode_t node;
+
+	/* List of k_work items submitted from this worker. */
+	sys_slist_t pending;
+
+	/* The CPU the thread is pinned to, or -1. */
+	int cpu;
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4543,6 +4834,67 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs consecutive messages from @a data
+ * to message queue @a msgq under a single lock, waking at most one
+ * scheduling pass and signalling pollers once. Messages are sent in
+ * order until the queue is full; the rest are not sent.
+ *
+ * If no message can be sent at all, the routine waits like k_msgq_put()
+ * for the first one to be accepted and then sends as many of the others
+ * as fit without waiting.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to an array of @a num_msgs messages.
+ * @param num_msgs Number of messages in @a data.
+ * @param timeout Non-negative waiting period to add the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages sent, from 1 to @a num_msgs, or 0 if
+ *         @a num_msgs is 0.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			      uint32_t num_msgs, k_timeout_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq in a "first in, first out" manner under a single lock, and
+ * stores them consecutively in @a data.
+ *
+ * If the queue is empty, the routine waits like k_msgq_get() for the
+ * first message and then also takes any others that are queued, without
+ * waiting for more.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold @a num_msgs messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received, from 1 to @a num_msgs, or 0 if
+ *         @a num_msgs is 0.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_many(struct k_msgq *msgq, void *data,
+			      uint32_t num_msgs, k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -5003,6 +5355,17 @@ __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+struct k_mem_slab_magazine {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t count;
+	/* Allocations served by, and missing, this magazine */
+	uint32_t hits;
+	uint32_t misses;
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5010,10 +5373,16 @@ struct k_mem_slab {
 	size_t block_size;
 	char *buffer;
 	char *free_list;
+	/* Blocks not in free_list, including those cached in magazines */
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
 #endif
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	struct k_mem_slab_magazine magazines[CONFIG_MP_MAX_NUM_CPUS];
+	/* Set while threads may be waiting, frees then skip the magazines */
+	bool magazine_bypass;
+#endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 };
@@ -5154,6 +5523,16 @@ extern int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+extern uint32_t z_mem_slab_num_used_get(struct k_mem_slab *slab);
+#endif
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5166,7 +5545,11 @@ extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	return z_mem_slab_num_used_get(slab);
+#else
 	return slab->num_used;
+#endif
 }
 
 /**
@@ -5201,7 +5584,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->num_blocks - slab->num_used;
+	return slab->num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -6042,6 +6425,49 @@ extern void k_sys_runtime_stats_enable(void);
  */
 extern void k_sys_runtime_stats_disable(void);
 
+#if defined(CONFIG_SCHED_LATENCY_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the scheduling latency statistics of a thread
+ *
+ * This routine copies the wakeup latency histogram, the time spent ready
+ * to run and the preemption count of the specified thread.
+ *
+ * @param thread ID of thread.
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+int k_thread_sched_latency_get(k_tid_t thread,
+			       struct k_sched_latency_stats *stats);
+
+/**
+ * @brief Reset the scheduling latency statistics of a thread
+ *
+ * @param thread ID of thread.
+ * @return -EINVAL if invalid thread ID, otherwise 0
+ */
+int k_thread_sched_latency_reset(k_tid_t thread);
+
+/**
+ * @brief Get the scheduling latency statistics of a CPU
+ *
+ * The statistics of a CPU cover all threads that were switched in or out
+ * on it, except for its idle thread.
+ *
+ * @param cpu Index of the CPU.
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if invalid CPU index or null pointer, otherwise 0
+ */
+int k_cpu_sched_latency_get(int cpu, struct k_sched_latency_stats *stats);
+
+/**
+ * @brief Reset the scheduling latency statistics of a CPU
+ *
+ * @param cpu Index of the CPU.
+ * @return -EINVAL if invalid CPU index, otherwise 0
+ */
+int k_cpu_sched_latency_reset(int cpu);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,4 +30,25 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+/**
+ * Structure used to track scheduling latency statistics about both
+ * threads and CPUs. All times are in hardware cycles.
+ */
+
+struct k_sched_latency_stats {
+	/**
+	 * Wakeups by the latency from being made ready to being switched
+	 * in: entry 0 counts no latency, and entry n a latency of at least
+	 * 2^(n-1) and less than 2^n cycles. The last entry also counts all
+	 * longer latencies.
+	 */
+	uint32_t  histogram[CONFIG_SCHED_LATENCY_STATS_BUCKETS];
+	uint64_t  ready_cycles; /**< total # of cycles spent ready to run */
+	uint32_t  max_latency;  /**< longest wakeup latency in cycles */
+	uint32_t  wakeups;      /**< \# of wakeups that were switched in */
+	uint32_t  preemptions;  /**< \# of switches out while ready to run */
+};
+#endif
+
 #endif
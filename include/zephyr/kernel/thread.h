@@ -141,6 +141,16 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif
+
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	struct k_sched_latency_stats latency;
+
+	/* Cycle at which the thread was made ready to run, 0 if running */
+	uint32_t ready0;
+
+	/* True if [ready0] marks a wakeup rather than a preemption */
+	bool ready_woken;
+#endif
 };
 
 typedef struct _thread_base _thread_base_t;
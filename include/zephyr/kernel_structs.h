@@ -144,6 +144,11 @@ struct _cpu {
 #endif
 #endif
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	/* Latency statistics of the threads switched in on this CPU */
+	struct k_sched_latency_stats latency;
+#endif
+
 	/* Per CPU architecture specifics */
 	struct _cpu_arch arch;
 };
@@ -184,8 +189,8 @@ struct z_kernel {
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	/* Need to signal an IPI at the next scheduling point */
-	bool pending_ipi;
+	/* Bitmap of CPUs to signal an IPI at the next scheduling point */
+	atomic_t pending_ipi;
 #endif
 };
 
@@ -247,6 +252,10 @@ struct _timeout {
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Ticks the expiry may be delayed by to share a wakeup */
+	uint32_t slack;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
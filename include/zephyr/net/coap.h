@@ -239,6 +239,13 @@ struct coap_packet {
 	uint8_t hdr_len; /* CoAP header length */
 	uint16_t opt_len; /* Total options length (delta + len + value) */
 	uint16_t delta; /* Used for delta calculation in CoAP packet */
+#if defined(CONFIG_COAP_OPTION_INDEX)
+	struct {
+		uint16_t code; /* Option number */
+		uint16_t offset; /* Offset of the option header */
+	} opt_index[CONFIG_COAP_OPTION_INDEX_SIZE]; /* Options of a parsed packet */
+	uint8_t opt_index_len; /* Number of indexed options, 0 if not indexed */
+#endif
 #if defined(CONFIG_COAP_KEEP_USER_DATA)
 	void *user_data; /* Application specific user data */
 #endif
@@ -525,6 +532,99 @@ int coap_handle_request(struct coap_packet *cpkt,
 			uint8_t opt_num,
 			struct sockaddr *addr, socklen_t addr_len);
 
+/**
+ * @brief Node of a CoAP resource router, one per resource path segment.
+ *
+ * The nodes are only accessed by the router functions, the application
+ * provides the storage for them.
+ */
+struct coap_router_node {
+	const struct coap_router_node *parent;
+	struct coap_router_node *hash_next;
+	struct coap_router_node *bucket;
+	struct coap_router_node *any_segment;
+	struct coap_resource *resource;
+	struct coap_resource *any_path;
+	const char *segment;
+	uint16_t segment_len;
+};
+
+/**
+ * @brief CoAP resource router.
+ *
+ * A router arranges the paths of a resource array as a tree, so that
+ * finding the resource of a request depends on the depth of the request
+ * path instead of the number of resources.
+ */
+struct coap_router {
+	struct coap_router_node root;
+	struct coap_router_node *nodes;
+	size_t nodes_count;
+	size_t nodes_used;
+};
+
+/**
+ * @brief Build a router from an array of resources.
+ *
+ * One node is needed for each distinct path prefix of the resources, so
+ * the total number of path segments of all resources is always enough.
+ * The resources must not change while the router is in use.
+ *
+ * @param router Router to initialize
+ * @param resources Array of known resources, terminated by an entry
+ *        without a path
+ * @param nodes Storage for the router nodes
+ * @param nodes_count Number of entries in the nodes array
+ *
+ * @retval 0 in case of success.
+ * @retval -ENOMEM in case there are not enough nodes.
+ * @retval -E2BIG in case more than CONFIG_COAP_ROUTER_MAX_MATCHES resource
+ *         paths may match the same request path at once.
+ */
+int coap_router_init(struct coap_router *router,
+		     struct coap_resource *resources,
+		     struct coap_router_node *nodes,
+		     size_t nodes_count);
+
+/**
+ * @brief Find the resource matching the path of a request.
+ *
+ * The result is the same as with the linear search of
+ * coap_handle_request(), i.e. if several resources match, the one first
+ * in the resource array is returned.
+ *
+ * @param router Router built with coap_router_init()
+ * @param options Parsed options from coap_packet_parse()
+ * @param opt_num Number of options
+ *
+ * @return Matching resource, NULL if not found.
+ */
+struct coap_resource *coap_router_lookup(const struct coap_router *router,
+					 const struct coap_option *options,
+					 uint8_t opt_num);
+
+/**
+ * @brief When a request is received, call the appropriate methods of
+ * the resource found with a router.
+ *
+ * @param router Router built with coap_router_init()
+ * @param cpkt Packet received
+ * @param options Parsed options from coap_packet_parse()
+ * @param opt_num Number of options
+ * @param addr Peer address
+ * @param addr_len Peer address length
+ *
+ * @retval 0 in case of success.
+ * @retval -ENOTSUP in case of invalid request code.
+ * @retval -EPERM in case resource handler is not implemented.
+ * @retval -ENOENT in case the resource is not found.
+ */
+int coap_router_handle_request(const struct coap_router *router,
+			       struct coap_packet *cpkt,
+			       struct coap_option *options,
+			       uint8_t opt_num,
+			       struct sockaddr *addr, socklen_t addr_len);
+
 /**
  * Represents the size of each block that will be transferred using
  * block-wise transfers [RFC7959]:
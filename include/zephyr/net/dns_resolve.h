@@ -240,6 +240,11 @@ struct dns_resolve_context {
 		 * cannot be used to find correct pending query.
 		 */
 		uint16_t query_hash;
+
+		/** Index of the query which sent the question this query
+		 * waits the answer of, or -1 if this query sent it itself.
+		 */
+		int primary;
 	} queries[CONFIG_DNS_NUM_CONCUR_QUERIES];
 
 	/** Is this context in use */
@@ -352,6 +357,9 @@ int dns_resolve_cancel_with_name(struct dns_resolve_context *ctx,
  * We might send the query to multiple servers (if there are more than one
  * server configured), but we only use the result of the first received
  * response.
+ * If CONFIG_DNS_RESOLVER_CACHE is set and the answer is in the cache, the
+ * callback is called before this function returns, and the DNS id is set
+ * to 0 as there is no query to cancel.
  *
  * @param ctx DNS context
  * @param query What the caller wants to resolve.
@@ -399,7 +407,8 @@ struct dns_resolve_context *dns_resolve_get_default(void);
  * We might send the query to multiple servers (if there are more than one
  * server configured), but we only use the result of the first received
  * response.
- * This variant uses system wide DNS servers.
+ * This variant uses system wide DNS servers. Cached answers are given
+ * as described in dns_resolve_name().
  *
  * @param query What the caller wants to resolve.
  * @param type What kind of data the caller wants to get.
@@ -446,6 +455,36 @@ static inline int dns_cancel_addr_info(uint16_t dns_id)
 	return dns_resolve_cancel(dns_resolve_get_default(), dns_id);
 }
 
+/**
+ * DNS answer cache statistics
+ */
+struct dns_cache_stats {
+	/** Number of queries answered from the cache */
+	uint32_t hits;
+	/** Number of queries that had to be sent to a DNS server */
+	uint32_t misses;
+	/** Number of valid entries in the cache */
+	uint16_t entries;
+};
+
+/**
+ * @brief Get DNS answer cache statistics.
+ *
+ * @details Only available if CONFIG_DNS_RESOLVER_CACHE is set.
+ *
+ * @param stats Statistics are copied here.
+ */
+void dns_cache_get_stats(struct dns_cache_stats *stats);
+
+/**
+ * @brief Remove all the entries from the DNS answer cache.
+ *
+ * @details Only available if CONFIG_DNS_RESOLVER_CACHE is set. The answers
+ * of a context are removed automatically when it is closed or its DNS
+ * servers are reconfigured.
+ */
+void dns_cache_flush(void);
+
 /**
  * @}
  */
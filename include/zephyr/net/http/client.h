@@ -44,6 +44,7 @@ enum http_final_call {
 
 struct http_request;
 struct http_response;
+struct http_client_conn;
 
 /**
  * @typedef http_payload_cb_t
@@ -93,6 +94,37 @@ typedef void (*http_response_cb_t)(struct http_response *rsp,
 				   enum http_final_call final_data,
 				   void *user_data);
 
+/**
+ * @typedef http_connect_cb_t
+ * @brief Callback used to open a new connection to the HTTP server.
+ *
+ * @param conn Connection which needs a new socket
+ * @param user_data User specified data specified in http_client_conn_req()
+ *
+ * @return >=0 socket connected to the server,
+ *         <0  negative errno value, returned to the caller of
+ *             http_client_conn_req().
+ */
+typedef int (*http_connect_cb_t)(struct http_client_conn *conn,
+				 void *user_data);
+
+/**
+ * Timing of a HTTP request, in milliseconds from the start of the request.
+ */
+struct http_response_timing {
+	/** Connection opened. Zero if an open connection was used. */
+	uint32_t connected;
+
+	/** Request sent */
+	uint32_t sent;
+
+	/** First byte of the response received */
+	uint32_t first_byte;
+
+	/** Response complete, or the connection closed or timed out */
+	uint32_t done;
+};
+
 /**
  * HTTP response from the server.
  */
@@ -194,6 +226,20 @@ struct http_response {
 	uint8_t cl_present : 1;
 	uint8_t body_found : 1;
 	uint8_t message_complete : 1;
+	uint8_t skip_body : 1;
+
+	/** Set when the complete response allows the connection to be used
+	 * for another request, i.e. neither side asked to close it. The
+	 * socket can then be passed to the next http_client_req() call,
+	 * which saves a new connection and TLS handshake.
+	 * http_client_conn_req() does this for the caller.
+	 */
+	uint8_t keep_alive : 1;
+
+	/** Timing of the request. Complete when the response callback is
+	 * called with HTTP_DATA_FINAL.
+	 */
+	struct http_response_timing timing;
 };
 
 /** HTTP client internal data that the application should not touch
@@ -215,6 +261,12 @@ struct http_client_internal_data {
 
 	/** HTTP socket */
 	int sock;
+
+	/** Uptime when the request was started */
+	int64_t start;
+
+	/** The request is sent on a connection used by an earlier request */
+	bool reused;
 };
 
 /**
@@ -306,12 +358,36 @@ struct http_request {
 	const char **optional_headers;
 };
 
+/**
+ * Connection to a HTTP server, kept open between requests.
+ */
+struct http_client_conn {
+	/** User supplied callback function to call when a new connection
+	 * is needed.
+	 */
+	http_connect_cb_t connect;
+
+	/** Socket of the connection, -1 when there is none */
+	int sock;
+
+	/** Number of requests sent on the connections */
+	uint32_t requests;
+
+	/** Number of connections opened. The difference to the number of
+	 * requests is the number of requests which reused a connection.
+	 */
+	uint32_t connections;
+};
+
 /**
  * @brief Do a HTTP request. The callback is called when data is received
  * from the HTTP server. The caller must have created a connection to the
  * server before calling this function so connect() call must have be done
  * successfully for the socket.
  *
+ * The socket is not closed by this function. If the response has the
+ * keep_alive flag set, the same socket can be used for the next request.
+ *
  * @param sock Socket id of the connection.
  * @param req HTTP request information
  * @param timeout Max timeout to wait for the data. The timeout value cannot be
@@ -324,6 +400,51 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+/**
+ * @brief Initialize a HTTP connection. No connection is opened until the
+ * first request.
+ *
+ * @param conn Connection to initialize
+ * @param connect Callback to call when a new connection is needed
+ */
+void http_client_conn_init(struct http_client_conn *conn,
+			   http_connect_cb_t connect);
+
+/**
+ * @brief Do a HTTP request on a connection kept open between requests.
+ *
+ * The connection of the previous request is used if its response allowed
+ * it, see the keep_alive flag of the response. Otherwise, or if there is
+ * no connection yet, a new one is opened with the connect callback of the
+ * connection. The connection is closed after a response which does not
+ * allow to keep it, and after an error.
+ *
+ * If the server closed an open connection before the request reached it,
+ * a request with an idempotent method (GET, HEAD, OPTIONS, TRACE, PUT or
+ * DELETE) is sent again, once, on a new connection. The payload and header
+ * callbacks of the request are then called again. As the server may have
+ * processed the request before closing the connection, requests with other
+ * methods, such as POST or PATCH, fail instead and are left for the caller
+ * to retry.
+ *
+ * @param conn Connection to the server.
+ * @param req HTTP request information
+ * @param timeout Max timeout to wait for the data, see http_client_req().
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_conn_req(struct http_client_conn *conn,
+			 struct http_request *req,
+			 int32_t timeout, void *user_data);
+
+/**
+ * @brief Close the connection of a HTTP connection, if it has one.
+ *
+ * @param conn Connection to close
+ */
+void http_client_conn_close(struct http_client_conn *conn);
+
 #ifdef __cplusplus
 }
 #endif
@@ -138,6 +138,12 @@ struct lwm2m_ctx {
 #endif
 	sys_slist_t observer;
 
+	/** Earliest time at which one of the observers may be due, so that
+	 *  the engine does not need to scan all of them on every iteration.
+	 *  For internal LwM2M engine use.
+	 */
+	int64_t next_notify_timestamp;
+
 	/** A pointer to currently processed request, for internal LwM2M engine
 	 *  use. The underlying type is ``struct lwm2m_message``, but since it's
 	 *  declared in a private header and not exposed to the application,
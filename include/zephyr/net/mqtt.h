@@ -450,6 +450,18 @@ struct mqtt_transport {
 #endif
 };
 
+/** @brief QoS 1 or QoS 2 message awaiting acknowledgment. */
+struct mqtt_inflight {
+	/** Internal. Publish parameters, kept for retransmission. */
+	struct mqtt_publish_param param;
+
+	/** Internal. Entry holds a message. */
+	bool used;
+
+	/** Internal. PUBREC received, PUBCOMP awaited. */
+	bool released;
+};
+
 /** @brief MQTT internal state. */
 struct mqtt_internal {
 	/** Internal. Mutex to protect access to the client instance. */
@@ -468,6 +480,11 @@ struct mqtt_internal {
 
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
+
+#if defined(CONFIG_MQTT_INFLIGHT_WINDOW)
+	/** Internal. Published messages awaiting acknowledgment. */
+	struct mqtt_inflight inflight[CONFIG_MQTT_INFLIGHT_WINDOW_SIZE];
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
 };
 
 /**
@@ -518,7 +535,11 @@ struct mqtt_client {
 	/** Size of receive buffer. */
 	uint32_t rx_buf_size;
 
-	/** Transmit buffer used for creating MQTT packet in TX path. */
+	/** Transmit buffer used for creating MQTT packet in TX path.
+	 *  The payload of a PUBLISH message is sent straight from the
+	 *  application buffer, so this buffer only needs to hold the packet
+	 *  headers and the topic.
+	 */
 	uint8_t *tx_buf;
 
 	/** Size of transmit buffer. */
@@ -602,11 +623,34 @@ int mqtt_connect(struct mqtt_client *client);
  * @param[in] param Parameters to be used for the publish message.
  *                  Shall not be NULL.
  *
+ * @note With CONFIG_MQTT_INFLIGHT_WINDOW, the topic and payload of a QoS 1 or
+ *       QoS 2 message shall stay valid until the message is acknowledged.
+ *
  * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ *         -EAGAIN if the in-flight window is full.
  */
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to publish several messages with a single transport write.
+ *
+ * Small messages are packed together, so that they do not need one write
+ * each. The messages are sent in order. If the TX buffer cannot hold the
+ * headers of all messages, they are split into several writes.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] params Parameters of the publish messages. Shall not be NULL.
+ * @param[in] count Number of messages in @p params.
+ *
+ * @return Number of messages sent, which is less than @p count if the
+ *         in-flight window got full, or a negative error code (errno.h)
+ *         indicating reason of failure.
+ */
+int mqtt_publish_batch(struct mqtt_client *client,
+		       const struct mqtt_publish_param *params, size_t count);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
@@ -772,6 +816,9 @@ int mqtt_input(struct mqtt_client *client);
  *        be called within the MQTT event handler, when MQTT PUBLISH message is
  *        notified.
  *
+ * The payload is read from the transport directly into @p buffer, without
+ * going through the receive buffer of the client.
+ *
  * @note This is a non-blocking call.
  *
  * @param[in] client Client instance for which the procedure is requested.
@@ -282,6 +282,13 @@ __net_socket struct net_context {
 		/** Mutex used by condition variable */
 		struct k_mutex *lock;
 	} cond;
+
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+	/** Incremented whenever the context is allocated, so that a zero-copy
+	 *  receive loan can tell whether the context was reused.
+	 */
+	uint32_t generation;
+#endif
 #endif /* CONFIG_NET_SOCKETS */
 
 #if defined(CONFIG_NET_OFFLOAD)
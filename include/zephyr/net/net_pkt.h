@@ -128,6 +128,13 @@ struct net_pkt {
 	uint64_t txtime;
 #endif /* CONFIG_NET_PKT_TXTIME */
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/** Segment size the packet is split to before it is sent, 0 if the
+	 * packet is sent as is.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_TCP_GSO */
+
 	/** Reference counter */
 	atomic_t atomic_ref;
 
@@ -1023,6 +1030,31 @@ static inline void net_pkt_set_txtime(struct net_pkt *pkt, uint64_t txtime)
 }
 #endif /* CONFIG_NET_PKT_TXTIME */
 
+#if defined(CONFIG_NET_TCP_GSO)
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	return pkt->gso_size;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t gso_size)
+{
+	pkt->gso_size = gso_size;
+}
+#else
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t gso_size)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(gso_size);
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 #if defined(CONFIG_NET_PKT_TXTIME_STATS_DETAIL) || \
 	defined(CONFIG_NET_PKT_RXTIME_STATS_DETAIL)
 static inline uint32_t *net_pkt_stats_tick(struct net_pkt *pkt)
@@ -438,6 +438,73 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+/**
+ * @brief Zero-copy receive loan, see @ref zsock_recv_zc.
+ */
+struct zsock_zc_rx {
+	/** Array of fragment views, provided by the caller. The views are
+	 *  filled by @ref zsock_recv_zc and point into the network stack
+	 *  buffers, so they must be treated as read-only.
+	 */
+	struct iovec *iov;
+	/** Number of entries available in @a iov, set by the caller. */
+	size_t iovlen;
+	/** Number of entries in @a iov filled by @ref zsock_recv_zc. */
+	size_t iovcnt;
+	/** Total number of bytes lent out. */
+	size_t len;
+
+	/** @cond INTERNAL_HIDDEN */
+	void *pkt;
+	void *ctx;
+	uint32_t generation;
+	/** @endcond */
+};
+
+/**
+ * @brief Receive data without copying it into an application buffer
+ *
+ * @details
+ * Lends the application read-only views of the network buffer fragments
+ * holding the received data, instead of copying it like @ref zsock_recv
+ * does. For a ``SOCK_STREAM`` socket, at most @a rx->iovlen fragments of
+ * the oldest received segment are lent, the rest is returned by subsequent
+ * calls. For a ``SOCK_DGRAM`` socket, one datagram is lent per call, and
+ * any fragments not fitting in @a rx->iov are discarded.
+ *
+ * The buffers stay owned by the network stack until the loan is returned
+ * with @ref zsock_recv_zc_release. For stream sockets, the TCP receive
+ * window is only reopened when the loan is released. Several loans may be
+ * outstanding at the same time.
+ *
+ * Only native (non-TLS, non-offloaded) TCP and UDP sockets are supported.
+ * This function is not available to user mode threads, as it hands out
+ * pointers to kernel memory.
+ * Requires :kconfig:option:`CONFIG_NET_SOCKETS_RECV_ZEROCOPY`.
+ *
+ * @param sock Socket descriptor.
+ * @param rx Loan descriptor, with @a iov and @a iovlen set by the caller.
+ * @param flags Only ``ZSOCK_MSG_DONTWAIT`` is supported.
+ *
+ * @return Number of bytes lent, 0 on end of stream, or -1 with errno set.
+ */
+ssize_t zsock_recv_zc(int sock, struct zsock_zc_rx *rx, int flags);
+
+/**
+ * @brief Return a zero-copy receive loan to the network stack
+ *
+ * @details
+ * Releases the buffers lent by @ref zsock_recv_zc. The fragment views in
+ * @a rx must not be accessed afterwards. A loan may be released after the
+ * socket was closed.
+ *
+ * @param sock Socket descriptor the loan was obtained from.
+ * @param rx Loan descriptor filled by @ref zsock_recv_zc.
+ *
+ * @return 0 on success, -1 with errno set otherwise.
+ */
+int zsock_recv_zc_release(int sock, struct zsock_zc_rx *rx);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
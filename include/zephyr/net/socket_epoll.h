@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+
+/**
+ * @brief BSD Sockets compatible API
+ * @defgroup bsd_sockets BSD Sockets compatible API
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/toolchain.h>
+#include <zephyr/net/socket_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Register a socket in the event set */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** Remove a socket from the event set */
+#define ZSOCK_EPOLL_CTL_DEL 2
+/** Change the events a registered socket is watched for */
+#define ZSOCK_EPOLL_CTL_MOD 3
+
+/** Event set entry, used by @ref zsock_epoll_ctl and @ref zsock_epoll_wait */
+struct zsock_epoll_event {
+	/** ZSOCK_POLL* event mask, requested or reported */
+	uint32_t events;
+	/** User data, returned unchanged with reported events */
+	union {
+		void *ptr;
+		int fd;
+		uint32_t u32;
+		uint64_t u64;
+	} data;
+};
+
+/**
+ * @brief Create a persistent socket event set
+ *
+ * @details
+ * Unlike @ref zsock_poll, which rebuilds its wait list on every call, an
+ * event set keeps the registered sockets armed between calls. Sockets
+ * report readiness changes into a ready list of the set, so the cost of
+ * @ref zsock_epoll_wait depends on the number of ready sockets, not on the
+ * number of registered ones. Events are level-triggered.
+ *
+ * The returned descriptor is released with ``zsock_close()``.
+ * Requires :kconfig:option:`CONFIG_NET_SOCKETS_EPOLL`.
+ *
+ * @return Event set descriptor, or -1 with errno set.
+ */
+__syscall int zsock_epoll_create(void);
+
+/**
+ * @brief Add, modify or remove a socket in an event set
+ *
+ * @details
+ * Sockets closed with ``zsock_close()`` or ``close()`` are removed from all
+ * event sets automatically.
+ *
+ * @param epfd Event set descriptor.
+ * @param op ZSOCK_EPOLL_CTL_ADD, ZSOCK_EPOLL_CTL_MOD or ZSOCK_EPOLL_CTL_DEL.
+ * @param sock Socket descriptor.
+ * @param event Events to watch and user data. Ignored for
+ *              ZSOCK_EPOLL_CTL_DEL.
+ *
+ * @return 0 on success, -1 with errno set otherwise.
+ */
+__syscall int zsock_epoll_ctl(int epfd, int op, int sock,
+			      struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for events on an event set
+ *
+ * @details
+ * ``ZSOCK_POLLERR`` and ``ZSOCK_POLLHUP`` are always reported, even if not
+ * requested.
+ *
+ * @param epfd Event set descriptor.
+ * @param events Array receiving the reported events.
+ * @param maxevents Size of @a events array.
+ * @param timeout Timeout in milliseconds, or -1 to wait forever.
+ *
+ * @return Number of entries filled in @a events, 0 on timeout, or -1 with
+ *         errno set.
+ */
+__syscall int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			       int maxevents, int timeout);
+
+/**
+ * @brief Report a readiness change of an offloaded socket
+ *
+ * @details
+ * Offloaded sockets cannot be kept armed by the event set machinery, so
+ * they are polled through the ``ZFD_IOCTL_POLL_OFFLOAD`` ioctl every
+ * :kconfig:option:`CONFIG_NET_SOCKETS_EPOLL_OFFLOAD_POLL_INTERVAL`
+ * milliseconds while a waiter sleeps. Offloaded socket implementations may
+ * call this function whenever the readiness of a socket object may have
+ * changed, e.g. when data was received or transmit space became available,
+ * to have it checked immediately.
+ *
+ * Must be called from thread context.
+ *
+ * @param obj Socket object, as registered in the file descriptor table.
+ */
+void zsock_epoll_notify(void *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <syscalls/socket_epoll.h>
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_ */
@@ -11,6 +11,7 @@
 /* FIXME: For native_posix ssize_t, off_t. */
 #include <zephyr/fs/fs.h>
 #include <zephyr/sys/mutex.h>
+#include <zephyr/sys/slist.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -125,6 +126,37 @@ void *z_get_fd_obj_and_vtable(int fd, const struct fd_op_vtable **vtable,
 bool z_get_obj_lock_and_cond(void *obj, const struct fd_op_vtable *vtable, struct k_mutex **lock,
 			     struct k_condvar **cond);
 
+/**
+ * File descriptor close notifier.
+ *
+ * The callback is called with the descriptor number before the underlying
+ * object is closed, so that a subsystem referring to descriptors can drop
+ * them before the number is reused.
+ */
+struct fd_close_notifier {
+	sys_snode_t node;
+	void (*cb)(int fd);
+};
+
+/**
+ * @brief Register a file descriptor close notifier.
+ *
+ * Notifiers cannot be unregistered.
+ *
+ * @param notifier Notifier, must stay valid for the lifetime of the system
+ */
+void z_fd_close_notifier_register(struct fd_close_notifier *notifier);
+
+/**
+ * @brief Call the close notifiers of a file descriptor.
+ *
+ * Must be called by the close implementations that bypass close(), before
+ * the object of the descriptor is closed.
+ *
+ * @param fd File descriptor being closed
+ */
+void z_fd_close_notify(int fd);
+
 /**
  * @brief Call ioctl vmethod on an object using varargs.
  *
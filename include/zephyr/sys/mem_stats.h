@@ -25,6 +25,13 @@ struct sys_memory_stats {
 	size_t  free_bytes;
 	size_t  allocated_bytes;
 	size_t  max_allocated_bytes;
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	/* Memory slabs only: allocations served by the per-CPU magazines
+	 * and allocations which had to take the slab lock instead
+	 */
+	uint32_t magazine_hits;
+	uint32_t magazine_misses;
+#endif
 };
 
 #ifdef __cplusplus
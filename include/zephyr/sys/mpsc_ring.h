@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_SYS_MPSC_RING_H_
+#define ZEPHYR_INCLUDE_SYS_MPSC_RING_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Multi producer, single consumer element ring API
+ * @defgroup mpsc_ring MPSC (Multi producer, single consumer) element ring API
+ * @ingroup datastructure_apis
+ * @{
+ */
+
+/*
+ * Multi producer, single consumer element ring stores fixed size elements
+ * in first-in-first-out order without taking any lock, so that interrupt
+ * handlers can hand data to a thread without masking interrupts.
+ *
+ * Producers claim an element of the ring, fill it in place and commit it.
+ * Elements may be committed in any order, but are read in the order they
+ * were claimed. The consumer claims the oldest committed element, reads it
+ * in place and frees it.
+ *
+ * Each element has a sequence number telling which lap of the ring it was
+ * last written or freed on, so producers only contend on the write index
+ * and the consumer never writes anything producers read other than the
+ * sequence numbers.
+ *
+ * A consumer waiting for data blocks on a semaphore, which is only given
+ * when an element is committed at the read position, i.e. when the ring
+ * goes from having nothing to read to having something to read.
+ */
+
+/**@defgroup MPSC_RING_FLAGS MPSC element ring flags
+ * @{
+ */
+
+/** @brief Flag indicating that elements are only ever put from one context.
+ *
+ * The producer then claims elements without an atomic compare and swap.
+ */
+#define MPSC_RING_SINGLE_PRODUCER BIT(0)
+
+/**@} */
+
+/** @brief MPSC element ring structure. */
+struct mpsc_ring {
+	/** Next position to be claimed by a producer. */
+	atomic_t wr_idx;
+
+	/** Next position to be claimed by the consumer. */
+	atomic_t rd_idx;
+
+	/** Sequence number of each element, relative to its index. */
+	atomic_t *seq;
+
+	/** Element storage. */
+	uint8_t *buf;
+
+	/** Size of an element in bytes. */
+	size_t elem_size;
+
+	/** Number of elements minus one. */
+	uint32_t mask;
+
+	/** Flags. */
+	uint32_t flags;
+
+	/** Given when the ring stops being empty. */
+	struct k_sem sem;
+};
+
+/**
+ * @brief Statically define and initialize an MPSC element ring.
+ *
+ * The ring can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct mpsc_ring <name>; @endcode
+ *
+ * @param name Name of the ring.
+ * @param type Type of the elements.
+ * @param num_elems Number of elements, a power of two no smaller than 2.
+ * @param _flags Flags, see @ref MPSC_RING_FLAGS.
+ */
+#define MPSC_RING_DEFINE(name, type, num_elems, _flags)                     \
+	BUILD_ASSERT(IS_POWER_OF_TWO(num_elems) && ((num_elems) >= 2),      \
+		     "Number of elements must be a power of two");          \
+	static type _mpsc_ring_buf_##name[num_elems];                       \
+	static atomic_t _mpsc_ring_seq_##name[num_elems];                   \
+	struct mpsc_ring name = {                                           \
+		.seq = _mpsc_ring_seq_##name,                               \
+		.buf = (uint8_t *)_mpsc_ring_buf_##name,                    \
+		.elem_size = sizeof(type),                                  \
+		.mask = (num_elems) - 1,                                    \
+		.flags = (_flags),                                          \
+		.sem = Z_SEM_INITIALIZER(name.sem, 0, 1),                   \
+	}
+
+/** @brief Initialize an MPSC element ring.
+ *
+ * @param ring Ring.
+ * @param buf Storage for @p num_elems elements of @p elem_size bytes.
+ * @param seq Storage for @p num_elems sequence numbers.
+ * @param elem_size Size of an element in bytes.
+ * @param num_elems Number of elements, a power of two no smaller than 2.
+ * @param flags Flags, see @ref MPSC_RING_FLAGS.
+ */
+void mpsc_ring_init(struct mpsc_ring *ring, void *buf, atomic_t *seq,
+		    size_t elem_size, uint32_t num_elems, uint32_t flags);
+
+/** @brief Claim an element to be written in place.
+ *
+ * The element must be handed to mpsc_ring_put_commit() once written.
+ * Producers may hold several claimed elements at once. This function can
+ * be called from any context.
+ *
+ * @param ring Ring.
+ *
+ * @return Pointer to the element, or NULL if the ring is full.
+ */
+void *mpsc_ring_put_claim(struct mpsc_ring *ring);
+
+/** @brief Commit an element claimed with mpsc_ring_put_claim().
+ *
+ * Makes the element available to the consumer, once all elements claimed
+ * before it are committed too. Wakes up the consumer if it has nothing
+ * else to read.
+ *
+ * @param ring Ring.
+ * @param elem Element.
+ */
+void mpsc_ring_put_commit(struct mpsc_ring *ring, void *elem);
+
+/** @brief Copy an element into the ring.
+ *
+ * @param ring Ring.
+ * @param data Element data, of the ring's element size.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMEM if the ring is full.
+ */
+int mpsc_ring_put(struct mpsc_ring *ring, const void *data);
+
+/** @brief Claim the oldest element to be read in place.
+ *
+ * The element must be handed to mpsc_ring_free() once read, before
+ * another element can be claimed. This function must only be called from
+ * one context at a time, and only with @ref K_NO_WAIT from an interrupt.
+ *
+ * @param ring Ring.
+ * @param timeout Waiting period for an element to be committed, or one of
+ * the special values @ref K_NO_WAIT and @ref K_FOREVER.
+ *
+ * @return Pointer to the element, or NULL if none was committed in time.
+ */
+void *mpsc_ring_get_claim(struct mpsc_ring *ring, k_timeout_t timeout);
+
+/** @brief Free an element claimed with mpsc_ring_get_claim().
+ *
+ * @param ring Ring.
+ * @param elem Element.
+ */
+void mpsc_ring_free(struct mpsc_ring *ring, void *elem);
+
+/** @brief Copy the oldest element out of the ring.
+ *
+ * Same context restrictions as mpsc_ring_get_claim() apply.
+ *
+ * @param ring Ring.
+ * @param data Destination, of the ring's element size.
+ * @param timeout Waiting period for an element to be committed, or one of
+ * the special values @ref K_NO_WAIT and @ref K_FOREVER.
+ *
+ * @retval 0 on success.
+ * @retval -ENOMSG if returned without waiting.
+ * @retval -EAGAIN if waiting period timed out.
+ */
+int mpsc_ring_get(struct mpsc_ring *ring, void *data, k_timeout_t timeout);
+
+/** @brief Check if the consumer has an element to read.
+ *
+ * Only meaningful when called by the consumer.
+ *
+ * @param ring Ring.
+ *
+ * @retval true if an element is committed at the read position.
+ */
+bool mpsc_ring_is_pending(struct mpsc_ring *ring);
+
+/** @brief Get the semaphore signalling the ring.
+ *
+ * The semaphore is given whenever the ring stops being empty, so that a
+ * consumer can wait for several rings with k_poll() and
+ * @ref K_POLL_TYPE_SEM_AVAILABLE. The semaphore may be available while
+ * the ring is empty, so the consumer must read the ring with
+ * @ref K_NO_WAIT after waking up.
+ *
+ * @param ring Ring.
+ *
+ * @return Semaphore of the ring.
+ */
+static inline struct k_sem *mpsc_ring_sem_get(struct mpsc_ring *ring)
+{
+	return &ring->sem;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_MPSC_RING_H_ */
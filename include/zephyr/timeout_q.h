@@ -25,6 +25,9 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *to)
 {
 	sys_dnode_init(&to->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	to->slack = 0U;
+#endif
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
@@ -58,6 +61,10 @@ int32_t z_get_next_timeout_expiry(void);
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_timeout_slack_set(struct _timeout *to, k_timeout_t slack);
+#endif
+
 #else
 
 /* Stubs when !CONFIG_SYS_CLOCK_EXISTS */
@@ -437,4 +437,41 @@ static inline void z_sched_usage_switch(struct k_thread *thread)
 #endif
 }
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+/** @brief Mark a thread as made ready to run.
+ *
+ * Starts the measurement of the thread's wakeup latency.  Called with
+ * the scheduler lock held.
+ */
+void z_sched_latency_ready(struct k_thread *thread);
+
+/** @brief Account for a thread being switched out of the current CPU.
+ *
+ * A thread switched out while still ready to run counts as preempted,
+ * and starts measuring the time it spends waiting to run again.
+ * Called from the switch path with local interrupts masked, and with the
+ * scheduler lock held on SMP.
+ */
+void z_sched_latency_switched_out(struct k_thread *thread);
+
+/** @brief Account for a thread being switched in on the current CPU.
+ *
+ * Completes the measurement started by z_sched_latency_ready() or
+ * z_sched_latency_switched_out().  Called from the switch path with
+ * local interrupts masked, and with the scheduler lock held on SMP.
+ */
+void z_sched_latency_switched_in(struct k_thread *thread);
+#endif
+
+static inline void z_sched_latency_switch(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+#if defined(CONFIG_SCHED_LATENCY_STATS) && defined(CONFIG_USE_SWITCH)
+	if (thread != _current) {
+		z_sched_latency_switched_out(_current);
+		z_sched_latency_switched_in(thread);
+	}
+#endif
+}
+
 #endif /* ZEPHYR_KERNEL_INCLUDE_KSCHED_H_ */
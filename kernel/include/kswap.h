@@ -123,6 +123,7 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 
 	if (new_thread != old_thread) {
 		z_sched_usage_switch(new_thread);
+		z_sched_latency_switch(new_thread);
 
 #ifdef CONFIG_SMP
 		_current_cpu->swap_ok = 0;
@@ -73,6 +73,150 @@ out:
 SYS_INIT(init_mem_slab_module, PRE_KERNEL_1,
 	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+
+#define MAGAZINE_BATCH (CONFIG_MEM_SLAB_MAGAZINE_SIZE / 2)
+
+/* Blocks handed out to users.  Exact with the slab lock held, since
+ * blocks only move between the magazines and the free list under it,
+ * otherwise a snapshot.
+ */
+static uint32_t magazine_num_used(struct k_mem_slab *slab)
+{
+	uint32_t num_used = slab->num_used;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		num_used -= slab->magazines[i].count;
+	}
+
+	return num_used;
+}
+
+uint32_t z_mem_slab_num_used_get(struct k_mem_slab *slab)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	uint32_t num_used = magazine_num_used(slab);
+
+	k_spin_unlock(&slab->lock, key);
+
+	return num_used;
+}
+
+/* Take a block from the current CPU's magazine, without the slab lock */
+static bool magazine_alloc(struct k_mem_slab *slab, void **mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct k_mem_slab_magazine *mag = &slab->magazines[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+	bool ret = false;
+
+	if (mag->free_list != NULL) {
+		*mem = mag->free_list;
+		mag->free_list = *(char **)(mag->free_list);
+		mag->count--;
+		mag->hits++;
+		ret = true;
+	} else {
+		mag->misses++;
+	}
+
+	k_spin_unlock(&mag->lock, key);
+	arch_irq_unlock(irq_key);
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	/* max_used is shared by all CPUs, so it is only ever updated under
+	 * the slab lock, which may not be taken with a magazine lock held.
+	 * Tracing thus costs the lock the magazine saves.
+	 */
+	if (ret) {
+		key = k_spin_lock(&slab->lock);
+		slab->max_used = MAX(magazine_num_used(slab), slab->max_used);
+		k_spin_unlock(&slab->lock, key);
+	}
+#endif
+
+	return ret;
+}
+
+/* Put a block into the current CPU's magazine, without the slab lock.
+ * Fails when the magazine is full, or when threads may be waiting for
+ * a block and need to get it directly.
+ */
+static bool magazine_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct k_mem_slab_magazine *mag = &slab->magazines[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+	bool ret = false;
+
+	if (!slab->magazine_bypass &&
+	    mag->count < CONFIG_MEM_SLAB_MAGAZINE_SIZE) {
+		*(char **)mem = mag->free_list;
+		mag->free_list = mem;
+		mag->count++;
+		ret = true;
+	}
+
+	k_spin_unlock(&mag->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return ret;
+}
+
+/* Must be called with the slab lock held */
+static void magazine_refill(struct k_mem_slab *slab)
+{
+	struct k_mem_slab_magazine *mag = &slab->magazines[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+	while (mag->count < MAGAZINE_BATCH && slab->free_list != NULL) {
+		char *block = slab->free_list;
+
+		slab->free_list = *(char **)block;
+		*(char **)block = mag->free_list;
+		mag->free_list = block;
+		mag->count++;
+		slab->num_used++;
+	}
+
+	k_spin_unlock(&mag->lock, key);
+}
+
+/* Must be called with the slab lock held */
+static void magazine_flush(struct k_mem_slab *slab,
+			   struct k_mem_slab_magazine *mag, uint32_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&mag->lock);
+
+	while (count > 0U && mag->free_list != NULL) {
+		char *block = mag->free_list;
+
+		mag->free_list = *(char **)block;
+		*(char **)block = slab->free_list;
+		slab->free_list = block;
+		mag->count--;
+		slab->num_used--;
+		count--;
+	}
+
+	k_spin_unlock(&mag->lock, key);
+}
+
+/* Must be called with the slab lock held.  Bypass is set before the
+ * magazines are emptied, so a block freed into a magazine concurrently
+ * is either taken back here or freed through the slab lock instead.
+ */
+static void magazine_drain(struct k_mem_slab *slab)
+{
+	slab->magazine_bypass = true;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		magazine_flush(slab, &slab->magazines[i], UINT32_MAX);
+	}
+}
+
+#endif /* CONFIG_MEM_SLAB_MAGAZINE */
+
 int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 		    size_t block_size, uint32_t num_blocks)
 {
@@ -88,6 +232,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->max_used = 0U;
 #endif
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	(void)memset(slab->magazines, 0, sizeof(slab->magazines));
+	slab->magazine_bypass = false;
+#endif
+
 	rc = create_free_list(slab);
 	if (rc < 0) {
 		goto out;
@@ -103,19 +252,47 @@ out:
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	if (magazine_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+#endif
+
+	key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	if (slab->free_list == NULL) {
+		/* take back the blocks cached by all CPUs */
+		magazine_drain(slab);
+	}
+#endif
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
 		slab->num_used++;
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+		/* nobody waits while blocks are free */
+		slab->magazine_bypass = false;
+		magazine_refill(slab);
+#endif
+
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+		slab->max_used = MAX(magazine_num_used(slab), slab->max_used);
+#else
 		slab->max_used = MAX(slab->num_used, slab->max_used);
+#endif
 #endif
 
 		result = 0;
@@ -147,7 +324,18 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
+
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	if (magazine_free(slab, *mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+#endif
+
+	key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
 	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
@@ -162,6 +350,18 @@ void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 			return;
 		}
 	}
+
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	struct k_mem_slab_magazine *mag = &slab->magazines[_current_cpu->id];
+
+	/* nobody is waiting, see above */
+	slab->magazine_bypass = false;
+
+	if (mag->count == CONFIG_MEM_SLAB_MAGAZINE_SIZE) {
+		magazine_flush(slab, mag, MAGAZINE_BATCH);
+	}
+#endif
+
 	**(char ***) mem = slab->free_list;
 	slab->free_list = *(char **) mem;
 	slab->num_used--;
@@ -179,14 +379,30 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->num_used * slab->block_size;
-	stats->free_bytes = (slab->num_blocks - slab->num_used) * slab->block_size;
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	uint32_t num_used = magazine_num_used(slab);
+#else
+	uint32_t num_used = slab->num_used;
+#endif
+
+	stats->allocated_bytes = num_used * slab->block_size;
+	stats->free_bytes = (slab->num_blocks - num_used) * slab->block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->max_used * slab->block_size;
 #else
 	stats->max_allocated_bytes = 0;
 #endif
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	stats->magazine_hits = 0U;
+	stats->magazine_misses = 0U;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		stats->magazine_hits += slab->magazines[i].hits;
+		stats->magazine_misses += slab->magazines[i].misses;
+	}
+#endif
+
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -201,7 +417,11 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+	slab->max_used = magazine_num_used(slab);
+#else
 	slab->max_used = slab->num_used;
+#endif
 
 	k_spin_unlock(&slab->lock, key);
 
@@ -32,6 +32,30 @@ static inline void handle_poll_events(struct k_msgq *msgq, uint32_t state)
 }
 #endif /* CONFIG_POLL */
 
+/* Must be invoked with msgq lock held and the queue not full */
+static inline void msgq_buffer_put(struct k_msgq *msgq, const void *data)
+{
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+	(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
+	msgq->write_ptr += msgq->msg_size;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs++;
+}
+
+/* Must be invoked with msgq lock held and the queue not empty */
+static inline void msgq_buffer_get(struct k_msgq *msgq, void *data)
+{
+	(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
+	msgq->read_ptr += msgq->msg_size;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs--;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -141,14 +165,7 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 			return 0;
 		} else {
 			/* put message in queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
+			msgq_buffer_put(msgq, data);
 #ifdef CONFIG_POLL
 			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
@@ -219,12 +236,7 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 
 	if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
-		(void)memcpy(data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
+		msgq_buffer_get(msgq, data);
 
 		/* handle first thread waiting to write (if any) */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
@@ -232,15 +244,7 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
 			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
-			}
-			msgq->used_msgs++;
+			msgq_buffer_put(msgq, pending_thread->base.swap_data);
 
 			/* wake up waiting thread */
 			arch_thread_return_value_set(pending_thread, 0);
@@ -285,6 +289,187 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif
 
+int z_impl_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			   uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *msg = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	bool woken = false;
+	bool buffered = false;
+	uint32_t count = 0U;
+	int result;
+
+	if (num_msgs == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+
+	while ((count < num_msgs) && (msgq->used_msgs < msgq->max_msgs)) {
+		/* readers only wait while the queue is empty */
+		pending_thread = buffered ? NULL :
+				 z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread != NULL) {
+			/* give message to waiting thread */
+			(void)memcpy(pending_thread->base.swap_data, msg,
+				     msgq->msg_size);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			woken = true;
+		} else {
+			msgq_buffer_put(msgq, msg);
+			buffered = true;
+		}
+		msg += msgq->msg_size;
+		count++;
+	}
+
+	if (count > 0U) {
+#ifdef CONFIG_POLL
+		if (buffered) {
+			handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+		}
+#endif /* CONFIG_POLL */
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, 0);
+
+		if (woken) {
+			z_reschedule(&msgq->lock, key);
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+
+		return count;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, -ENOMSG);
+
+		k_spin_unlock(&msgq->lock, key);
+
+		return -ENOMSG;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
+
+	/* wait for the first message to be taken, like k_msgq_put() */
+	_current->base.swap_data = (void *)msg;
+
+	result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+	if (result != 0) {
+		return result;
+	}
+
+	/* then add as many of the others as fit without waiting */
+	result = z_impl_k_msgq_put_many(msgq, msg + msgq->msg_size,
+					num_msgs - 1U, K_NO_WAIT);
+
+	return 1 + MAX(result, 0);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+					 uint32_t num_msgs, k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_many(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_put_many_mrsh.c>
+#endif
+
+int z_impl_k_msgq_get_many(struct k_msgq *msgq, void *data,
+			   uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	char *msg = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	bool woken = false;
+	uint32_t count = 0U;
+	int result;
+
+	if (num_msgs == 0U) {
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+
+	while ((count < num_msgs) && (msgq->used_msgs > 0U)) {
+		msgq_buffer_get(msgq, msg);
+		msg += msgq->msg_size;
+		count++;
+
+		/* refill the freed slot from the first waiting writer */
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread != NULL) {
+			msgq_buffer_put(msgq, pending_thread->base.swap_data);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			woken = true;
+		}
+	}
+
+	if (count > 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, 0);
+
+		if (woken) {
+			z_reschedule(&msgq->lock, key);
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+
+		return count;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, -ENOMSG);
+
+		k_spin_unlock(&msgq->lock, key);
+
+		return -ENOMSG;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+
+	/* wait for the first message, like k_msgq_get() */
+	_current->base.swap_data = msg;
+
+	result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+	if (result != 0) {
+		return result;
+	}
+
+	/* then take as many of the others as are queued */
+	result = z_impl_k_msgq_get_many(msgq, msg + msgq->msg_size,
+					num_msgs - 1U, K_NO_WAIT);
+
+	return 1 + MAX(result, 0);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_many(struct k_msgq *msgq, void *data,
+					 uint32_t num_msgs, k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_many(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_get_many_mrsh.c>
+#endif
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -50,6 +50,9 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
 	mutex->lock_count = 0U;
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	mutex->spin_stats = (struct k_mutex_spin_stats){ 0 };
+#endif
 
 	z_waitq_init(&mutex->wait_q);
 
@@ -92,11 +95,73 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* The owner is read without the lock, so it may have released the mutex
+ * already.  That only ends the spinning, the mutex state is checked again
+ * under the lock.
+ */
+static bool owner_running(struct k_mutex *mutex)
+{
+	struct k_thread *owner = *(struct k_thread *volatile *)&mutex->owner;
+
+	return (owner != NULL) && (owner->base.cpu < CONFIG_MP_MAX_NUM_CPUS) &&
+	       (_kernel.cpus[owner->base.cpu].current == owner);
+}
+
+/* Spin while the owner of the mutex runs on another CPU and no thread is
+ * pended on the mutex, for at most CONFIG_MUTEX_ADAPTIVE_SPIN_US.  The
+ * pended threads get the mutex handed over first, and the owner only
+ * needs their priority inherited if it is preempted, in which case the
+ * caller stops spinning and pends too.
+ *
+ * The time spent spinning is taken off @a timeout, which becomes K_NO_WAIT
+ * if it expired meanwhile.
+ *
+ * Called with the lock held, which is released while spinning.
+ */
+static k_spinlock_key_t mutex_spin(struct k_mutex *mutex, k_spinlock_key_t key,
+				   k_timeout_t *timeout)
+{
+	uint32_t start = k_cycle_get_32();
+	uint32_t max = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	int64_t end;
+
+	if ((z_waitq_head(&mutex->wait_q) != NULL) || !owner_running(mutex)) {
+		return key;
+	}
+
+	end = sys_clock_timeout_end_calc(*timeout);
+	mutex->spin_stats.spins++;
+	k_spin_unlock(&lock, key);
+
+	do {
+		arch_spin_relax();
+	} while ((*(volatile uint32_t *)&mutex->lock_count != 0U) &&
+		 owner_running(mutex) &&
+		 (k_cycle_get_32() - start < max));
+
+	key = k_spin_lock(&lock);
+
+	if (mutex->lock_count == 0U) {
+		mutex->spin_stats.spin_acquired++;
+	}
+
+	if (!K_TIMEOUT_EQ(*timeout, K_FOREVER)) {
+		int64_t remaining = end - sys_clock_tick_get();
+
+		*timeout = (remaining > 0) ? Z_TIMEOUT_TICKS(remaining) : K_NO_WAIT;
+	}
+
+	return key;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
 	k_spinlock_key_t key;
 	bool resched = false;
+	k_timeout_t pend_timeout = timeout;
 
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
@@ -104,6 +169,13 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		key = mutex_spin(mutex, key, &pend_timeout);
+	}
+#endif
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -132,6 +204,15 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+	if (unlikely(K_TIMEOUT_EQ(pend_timeout, K_NO_WAIT))) {
+		/* the whole timeout was spent spinning */
+		k_spin_unlock(&lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, -EAGAIN);
+
+		return -EAGAIN;
+	}
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
@@ -143,7 +224,11 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
-	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	mutex->spin_stats.sleeps++;
+#endif
+
+	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, pend_timeout);
 
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
 
@@ -281,3 +366,32 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 }
 #include <syscalls/k_mutex_unlock_mrsh.c>
 #endif
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+int k_mutex_spin_stats_get(struct k_mutex *mutex,
+			   struct k_mutex_spin_stats *stats)
+{
+	CHECKIF((mutex == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&lock) {
+		*stats = mutex->spin_stats;
+	}
+
+	return 0;
+}
+
+int k_mutex_spin_stats_reset(struct k_mutex *mutex)
+{
+	CHECKIF(mutex == NULL) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&lock) {
+		mutex->spin_stats = (struct k_mutex_spin_stats){ 0 };
+	}
+
+	return 0;
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
@@ -241,6 +241,60 @@ static inline int32_t z_vrfy_k_queue_alloc_prepend(struct k_queue *queue,
 #include <syscalls/k_queue_alloc_prepend_mrsh.c>
 #endif
 
+int32_t z_impl_k_queue_alloc_append_many(struct k_queue *queue, void **data,
+					  uint32_t num_items)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	struct k_thread *thread;
+	bool appended = false;
+	uint32_t count;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, true);
+
+	for (count = 0U; count < num_items; count++) {
+		/* readers only wait while the queue is empty */
+		thread = appended ? NULL : z_unpend_first_thread(&queue->wait_q);
+		if (thread != NULL) {
+			prepare_thread_to_run(thread, data[count]);
+			continue;
+		}
+
+		struct alloc_node *anode = z_thread_malloc(sizeof(*anode));
+
+		if (anode == NULL) {
+			break;
+		}
+		anode->data = data[count];
+		sys_sfnode_init(&anode->node, 0x1);
+		sys_sflist_append(&queue->data_q, &anode->node);
+		appended = true;
+	}
+
+	if (appended) {
+		handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, queue_insert, queue, true,
+		(count == 0U && num_items > 0U) ? -ENOMEM : 0);
+
+	z_reschedule(&queue->lock, key);
+
+	return (count == 0U && num_items > 0U) ? -ENOMEM : (int32_t)count;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int32_t z_vrfy_k_queue_alloc_append_many(struct k_queue *queue,
+						       void **data,
+						       uint32_t num_items)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(data, num_items, sizeof(void *)));
+
+	return z_impl_k_queue_alloc_append_many(queue, data, num_items);
+}
+#include <syscalls/k_queue_alloc_append_many_mrsh.c>
+#endif
+
 int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, append_list, queue);
@@ -348,6 +402,49 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
+int z_impl_k_queue_get_many(struct k_queue *queue, void **data,
+			    uint32_t max_items, k_timeout_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	uint32_t count = 0U;
+	int ret;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
+
+	while ((count < max_items) && !sys_sflist_is_empty(&queue->data_q)) {
+		sys_sfnode_t *node = sys_sflist_get_not_empty(&queue->data_q);
+
+		data[count++] = z_queue_node_peek(node, true);
+	}
+
+	if ((count > 0U) || (max_items == 0U) ||
+	    K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout,
+			(count > 0U) ? data[0] : NULL);
+
+		return count;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, get, queue, timeout);
+
+	ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout,
+		(ret != 0) ? NULL : _current->base.swap_data);
+
+	/* timed out, or woken without data by k_queue_cancel_wait() */
+	if ((ret != 0) || (_current->base.swap_data == NULL)) {
+		return 0;
+	}
+
+	data[0] = _current->base.swap_data;
+
+	return 1 + z_impl_k_queue_get_many(queue, data + 1, max_items - 1U,
+					   K_NO_WAIT);
+}
+
 bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
@@ -407,6 +504,17 @@ static inline void *z_vrfy_k_queue_get(struct k_queue *queue,
 }
 #include <syscalls/k_queue_get_mrsh.c>
 
+static inline int z_vrfy_k_queue_get_many(struct k_queue *queue, void **data,
+					  uint32_t max_items,
+					  k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(data, max_items, sizeof(void *)));
+
+	return z_impl_k_queue_get_many(queue, data, max_items, timeout);
+}
+#include <syscalls/k_queue_get_many_mrsh.c>
+
 static inline int z_vrfy_k_queue_is_empty(struct k_queue *queue)
 {
 	Z_OOPS(Z_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
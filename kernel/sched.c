@@ -272,20 +272,31 @@ static ALWAYS_INLINE void dequeue_thread(struct k_thread *thread)
 	}
 }
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+static void send_ipi(uint32_t cpu_bitmap)
+{
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+	arch_sched_directed_ipi(cpu_bitmap);
+#else
+	ARG_UNUSED(cpu_bitmap);
+	arch_sched_ipi();
+#endif
+}
+#endif
+
 static void signal_pending_ipi(void)
 {
-	/* Synchronization note: you might think we need to lock these
-	 * two steps, but an IPI is idempotent.  It's OK if we do it
-	 * twice.  All we require is that if a CPU sees the flag true,
-	 * it is guaranteed to send the IPI, and if a core sets
-	 * pending_ipi, the IPI will be sent the next time through
+	/* Synchronization note: the bitmap is claimed atomically, so
+	 * each flagged CPU is signaled by exactly one caller.  A CPU
+	 * flagged after the claim gets its IPI the next time through
 	 * this code.
 	 */
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		if (_kernel.pending_ipi) {
-			_kernel.pending_ipi = false;
-			arch_sched_ipi();
+		uint32_t cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+
+		if (cpu_bitmap != 0) {
+			send_ipi(cpu_bitmap);
 		}
 	}
 #endif
@@ -398,12 +409,53 @@ static void move_thread_to_end_of_prio_q(struct k_thread *thread)
 	update_cache(thread == _current);
 }
 
-static void flag_ipi(void)
+static void flag_ipi(uint32_t ipi_mask)
 {
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	if (arch_num_cpus() > 1) {
-		_kernel.pending_ipi = true;
+	if (arch_num_cpus() > 1 && ipi_mask != 0) {
+		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
+	}
+#else
+	ARG_UNUSED(ipi_mask);
+#endif
+}
+
+/* Returns the set of other CPUs that should reschedule because the
+ * thread just became runnable: those allowed to run it whose current
+ * thread it would preempt.  Must be called with the scheduler lock
+ * held, so that the per-CPU current threads are stable.
+ */
+static uint32_t ipi_mask_create(struct k_thread *thread)
+{
+#if defined(CONFIG_SMP) && defined(CONFIG_IPI_OPTIMIZE)
+	uint32_t ipi_mask = 0;
+	int currcpu = _current_cpu->id;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus; i++) {
+		struct k_thread *curr = _kernel.cpus[i].current;
+
+		if ((i == currcpu) || (curr == NULL)) {
+			continue;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((thread->base.cpu_mask & BIT(i)) == 0) {
+			continue;
+		}
+#endif
+
+		if (is_metairq(thread) ||
+		    (is_preempt(curr) && z_sched_prio_cmp(thread, curr) > 0)) {
+			ipi_mask |= BIT(i);
+		}
 	}
+
+	return ipi_mask;
+#else
+	ARG_UNUSED(thread);
+
+	return BIT_MASK(CONFIG_MP_MAX_NUM_CPUS);
 #endif
 }
 
@@ -457,11 +509,10 @@ static void slice_timeout(struct _timeout *t)
 	slice_expired[cpu] = true;
 
 	/* We need an IPI if we just handled a timeslice expiration
-	 * for a different CPU.  Ideally this would be able to target
-	 * the specific core, but that's not part of the API yet.
+	 * for a different CPU.
 	 */
 	if (IS_ENABLED(CONFIG_SMP) && cpu != _current_cpu->id) {
-		flag_ipi();
+		flag_ipi(BIT(cpu));
 	}
 }
 
@@ -576,11 +627,11 @@ static void update_cache(int preempt_ok)
 #endif
 }
 
-static bool thread_active_elsewhere(struct k_thread *thread)
+static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 {
-	/* True if the thread is currently running on another CPU.
-	 * There are more scalable designs to answer this question in
-	 * constant time, but this is fine for now.
+	/* Returns the other CPU the thread is currently running on, or
+	 * NULL.  There are more scalable designs to answer this question
+	 * in constant time, but this is fine for now.
 	 */
 #ifdef CONFIG_SMP
 	int currcpu = _current_cpu->id;
@@ -590,11 +641,11 @@ static bool thread_active_elsewhere(struct k_thread *thread)
 	for (int i = 0; i < num_cpus; i++) {
 		if ((i != currcpu) &&
 		    (_kernel.cpus[i].current == thread)) {
-			return true;
+			return &_kernel.cpus[i];
 		}
 	}
 #endif
-	return false;
+	return NULL;
 }
 
 static void ready_thread(struct k_thread *thread)
@@ -609,16 +660,19 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+		z_sched_latency_ready(thread);
+#endif
 		queue_thread(thread);
 		update_cache(0);
-		flag_ipi();
+		flag_ipi(ipi_mask_create(thread));
 	}
 }
 
 void z_ready_thread(struct k_thread *thread)
 {
 	K_SPINLOCK(&sched_spinlock) {
-		if (!thread_active_elsewhere(thread)) {
+		if (thread_active_elsewhere(thread) == NULL) {
 			ready_thread(thread);
 		}
 	}
@@ -916,7 +970,16 @@ bool z_set_prio(struct k_thread *thread, int prio)
 				dequeue_thread(thread);
 				thread->base.prio = prio;
 				queue_thread(thread);
+				flag_ipi(ipi_mask_create(thread));
 			} else {
+				struct _cpu *cpu = thread_active_elsewhere(thread);
+
+				/* A CPU whose thread got a lower priority may
+				 * now have a better thread to run
+				 */
+				if ((cpu != NULL) && (prio > thread->base.prio)) {
+					flag_ipi(BIT(cpu->id));
+				}
 				thread->base.prio = prio;
 			}
 			update_cache(1);
@@ -934,8 +997,6 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 {
 	bool need_sched = z_set_prio(thread, prio);
 
-	flag_ipi();
-
 	if (need_sched && _current->base.sched_locked == 0U) {
 		z_reschedule_unlocked();
 	}
@@ -1092,6 +1153,7 @@ void *z_get_next_switch_handle(void *interrupted)
 		new_thread = next_up();
 
 		z_sched_usage_switch(new_thread);
+		z_sched_latency_switch(new_thread);
 
 		if (old_thread != new_thread) {
 			update_metairq_preempt(new_thread);
@@ -1135,6 +1197,7 @@ void *z_get_next_switch_handle(void *interrupted)
 	return ret;
 #else
 	z_sched_usage_switch(_kernel.ready_q.cache);
+	z_sched_latency_switch(_kernel.ready_q.cache);
 	_current->switch_handle = interrupted;
 	set_current(_kernel.ready_q.cache);
 	return _current->switch_handle;
@@ -1382,6 +1445,27 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 #endif
 #endif
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_impl_k_thread_timeout_slack_set(k_tid_t thread, k_timeout_t slack)
+{
+	z_timeout_slack_set(&thread->base.timeout, slack);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_thread_timeout_slack_set(k_tid_t thread,
+						     k_timeout_t slack)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+	Z_OOPS(Z_SYSCALL_VERIFY_MSG(!K_TIMEOUT_EQ(slack, K_FOREVER) &&
+				    (Z_TICK_ABS(slack.ticks) < 0),
+				    "invalid timeout slack"));
+
+	z_impl_k_thread_timeout_slack_set(thread, slack);
+}
+#include <syscalls/k_thread_timeout_slack_set_mrsh.c>
+#endif
+#endif
+
 bool k_can_yield(void)
 {
 	return !(k_is_pre_kernel() || k_is_in_isr() ||
@@ -1533,8 +1617,6 @@ void z_impl_k_wakeup(k_tid_t thread)
 	z_mark_thread_as_not_suspended(thread);
 	z_ready_thread(thread);
 
-	flag_ipi();
-
 	if (!arch_is_in_isr()) {
 		z_reschedule_unlocked();
 	}
@@ -1751,9 +1833,9 @@ void z_thread_abort(struct k_thread *thread)
 		end_thread(thread);
 	}
 
-	bool active = thread_active_elsewhere(thread);
+	struct _cpu *cpu = thread_active_elsewhere(thread);
 
-	if (active) {
+	if (cpu != NULL) {
 		/* It's running somewhere else, flag and poke */
 		thread->base.thread_state |= _THREAD_ABORTING;
 
@@ -1761,7 +1843,7 @@ void z_thread_abort(struct k_thread *thread)
 		 * here, not deferred!
 		 */
 #ifdef CONFIG_SCHED_IPI_SUPPORTED
-		arch_sched_ipi();
+		send_ipi(BIT(cpu->id));
 #endif
 	}
 
@@ -1778,7 +1860,7 @@ void z_thread_abort(struct k_thread *thread)
 			key = k_spin_lock(&sched_spinlock);
 			z_sched_switch_spin(thread);
 			k_spin_unlock(&sched_spinlock, key);
-		} else if (active) {
+		} else if (cpu != NULL) {
 			/* Threads can join */
 			add_to_waitq_locked(_current, &thread->join_queue);
 			z_swap(&sched_spinlock, key);
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+
+#include <ksched.h>
+#include <kswap.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/check.h>
+#include <zephyr/arch/common/ffs.h>
+
+/* The statistics are only written with the scheduler lock held or, on
+ * uniprocessor builds, from the switch path with interrupts masked, so
+ * the hot path needs no lock of its own.  Readers take the scheduler
+ * lock for a consistent snapshot.
+ */
+
+static uint32_t latency_now(void)
+{
+	uint32_t now = k_cycle_get_32();
+
+	/* Edge case: we use a zero as a null ("not waiting to run") */
+	return (now == 0) ? 1 : now;
+}
+
+/* Idle and dummy threads never wait to run in a meaningful way */
+static bool latency_tracked(struct k_thread *thread)
+{
+	return (thread != NULL) && !z_is_idle_thread_object(thread) &&
+	       ((thread->base.thread_state & _THREAD_DUMMY) == 0U);
+}
+
+static void latency_update(struct k_sched_latency_stats *stats,
+			   uint32_t cycles, bool woken)
+{
+	stats->ready_cycles += cycles;
+
+	if (woken) {
+		unsigned int bucket = MIN(find_msb_set(cycles),
+					  CONFIG_SCHED_LATENCY_STATS_BUCKETS - 1);
+
+		stats->histogram[bucket]++;
+		stats->wakeups++;
+		stats->max_latency = MAX(stats->max_latency, cycles);
+	}
+}
+
+void z_sched_latency_ready(struct k_thread *thread)
+{
+	if (!latency_tracked(thread)) {
+		return;
+	}
+
+	thread->base.ready0 = latency_now();
+	thread->base.ready_woken = true;
+}
+
+void z_sched_latency_switched_out(struct k_thread *thread)
+{
+	if (!latency_tracked(thread) || !z_is_thread_ready(thread)) {
+		return;
+	}
+
+	thread->base.latency.preemptions++;
+	_current_cpu->latency.preemptions++;
+
+	thread->base.ready0 = latency_now();
+	thread->base.ready_woken = false;
+}
+
+void z_sched_latency_switched_in(struct k_thread *thread)
+{
+	if (!latency_tracked(thread)) {
+		return;
+	}
+
+	uint32_t r0 = thread->base.ready0;
+
+	if (r0 != 0) {
+		uint32_t cycles = latency_now() - r0;
+		bool woken = thread->base.ready_woken;
+
+		latency_update(&thread->base.latency, cycles, woken);
+		latency_update(&_current_cpu->latency, cycles, woken);
+	}
+
+	thread->base.ready0 = 0;
+}
+
+int k_thread_sched_latency_get(k_tid_t thread,
+			       struct k_sched_latency_stats *stats)
+{
+	CHECKIF((thread == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&sched_spinlock) {
+		*stats = thread->base.latency;
+	}
+
+	return 0;
+}
+
+int k_thread_sched_latency_reset(k_tid_t thread)
+{
+	CHECKIF(thread == NULL) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&sched_spinlock) {
+		thread->base.latency = (struct k_sched_latency_stats) {};
+	}
+
+	return 0;
+}
+
+int k_cpu_sched_latency_get(int cpu, struct k_sched_latency_stats *stats)
+{
+	CHECKIF((cpu < 0) || ((unsigned int)cpu >= arch_num_cpus()) ||
+		(stats == NULL)) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&sched_spinlock) {
+		*stats = _kernel.cpus[cpu].latency;
+	}
+
+	return 0;
+}
+
+int k_cpu_sched_latency_reset(int cpu)
+{
+	CHECKIF((cpu < 0) || ((unsigned int)cpu >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&sched_spinlock) {
+		_kernel.cpus[cpu].latency = (struct k_sched_latency_stats) {};
+	}
+
+	return 0;
+}
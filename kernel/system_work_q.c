@@ -19,6 +19,15 @@ static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 
 struct k_work_q k_sys_work_q;
 
+#if defined(CONFIG_SYSTEM_WORKQUEUE_WORKERS) && (CONFIG_SYSTEM_WORKQUEUE_WORKERS > 0)
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_worker_stacks,
+				   CONFIG_SYSTEM_WORKQUEUE_WORKERS,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+
+static struct k_work_queue_worker
+	sys_work_q_workers[CONFIG_SYSTEM_WORKQUEUE_WORKERS];
+#endif
+
 static int k_sys_work_q_init(void)
 {
 	struct k_work_queue_config cfg = {
@@ -30,6 +39,23 @@ static int k_sys_work_q_init(void)
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
 			    CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+
+#if defined(CONFIG_SYSTEM_WORKQUEUE_WORKERS) && (CONFIG_SYSTEM_WORKQUEUE_WORKERS > 0)
+	for (int i = 0; i < CONFIG_SYSTEM_WORKQUEUE_WORKERS; i++) {
+		int cpu = -1;
+
+		if (IS_ENABLED(CONFIG_SCHED_CPU_MASK) &&
+		    (i + 1 < CONFIG_MP_MAX_NUM_CPUS)) {
+			cpu = i + 1;
+		}
+
+		k_work_queue_add_worker(&k_sys_work_q, &sys_work_q_workers[i],
+					sys_work_q_worker_stacks[i],
+					K_KERNEL_STACK_SIZEOF(sys_work_q_worker_stacks[i]),
+					cpu);
+	}
+#endif
+
 	return 0;
 }
 
@@ -637,6 +637,11 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 		CONFIG_SCHED_THREAD_USAGE_AUTO_ENABLE;
 #endif
 
+#ifdef CONFIG_SCHED_LATENCY_STATS
+	new_thread->base.latency = (struct k_sched_latency_stats) {};
+	new_thread->base.ready0 = 0;
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC(k_thread, create, new_thread);
 
 	return stack_ptr;
@@ -1051,6 +1056,10 @@ void z_thread_mark_switched_in(void)
 	z_sched_usage_start(_current);
 #endif
 
+#if defined(CONFIG_SCHED_LATENCY_STATS) && !defined(CONFIG_USE_SWITCH)
+	z_sched_latency_switched_in(_current);
+#endif
+
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif
@@ -1062,6 +1071,10 @@ void z_thread_mark_switched_out(void)
 	z_sched_usage_stop();
 #endif
 
+#if defined(CONFIG_SCHED_LATENCY_STATS) && !defined(CONFIG_USE_SWITCH)
+	z_sched_latency_switched_out(_current);
+#endif
+
 #ifdef CONFIG_TRACING
 #ifdef CONFIG_THREAD_LOCAL_STORAGE
 	/* Dummy thread won't have TLS set up to run arbitrary code */
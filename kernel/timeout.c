@@ -11,11 +11,10 @@
 #include <zephyr/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 static struct k_spinlock timeout_lock;
 
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
@@ -36,6 +35,366 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+static int32_t elapsed(void)
+{
+	/* While sys_clock_announce() is executing, new relative timeouts will be
+	 * scheduled relatively to the currently firing timeout's original tick
+	 * value (=curr_tick) rather than relative to the current
+	 * sys_clock_elapsed().
+	 *
+	 * This means that timeouts being scheduled from within timeout callbacks
+	 * will be scheduled at well-defined offsets from the currently firing
+	 * timeout.
+	 *
+	 * As a side effect, the same will happen if an ISR with higher priority
+	 * preempts a timeout callback and schedules a timeout.
+	 *
+	 * The distinction is implemented by looking at announce_remaining which
+	 * will be non-zero while sys_clock_announce() is executing and zero
+	 * otherwise.
+	 */
+	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+}
+
+/* The timeout queue backends below provide:
+ *
+ * insert_timeout(): queue a timeout expiring dticks after curr_tick,
+ *   returns true if it is now the first timeout to expire
+ * remove_timeout(): remove a queued timeout
+ * timeout_dticks(): ticks from curr_tick until a queued timeout expires
+ * first_dticks(): ticks from curr_tick until the first timeout expires,
+ *   or K_TICKS_FOREVER if the queue is empty
+ * expire_first(): advance curr_tick by dt ticks to the expiry of the
+ *   first timeout, and remove and return that timeout
+ * advance(): advance curr_tick by ticks that expire no timeout
+ * wakeup_dticks(): ticks from curr_tick until the latest tick the first
+ *   timeouts may be delayed to within their slack, or K_TICKS_FOREVER if
+ *   the queue is empty (CONFIG_TIMEOUT_SLACK only)
+ *
+ * All of them must be called with timeout_lock held.
+ */
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/* Level l of the wheel holds the timeouts whose expiry tick differs from
+ * curr_tick in bits [WHEEL_BITS * l, WHEEL_BITS * (l + 1)) but not in any
+ * higher bit, in the slot given by those bits of the expiry tick.  So all
+ * the timeouts at level 0 expire within the current 64 tick period, the
+ * ones at level 1 within the current 4096 tick period and so on.  When
+ * curr_tick enters the period of a slot, the slot is moved one level down.
+ * The timeouts further away than the wheel reaches are kept in an
+ * unsorted overflow list.
+ *
+ * Within the lowest nonempty level, the first nonempty slot after curr_tick
+ * holds the timeouts that expire first.  The timeouts in a slot are in the
+ * order they were added, which keeps the firing order of the timeouts that
+ * expire at the same tick.
+ */
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS BIT(WHEEL_BITS)
+#define WHEEL_LEVELS 4
+
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint64_t wheel_used[WHEEL_LEVELS];
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+
+/* Expiry tick of the first timeout, if wheel_first_valid */
+static uint64_t wheel_first;
+static bool wheel_first_valid;
+
+/* The timeouts store their absolute expiry tick in dticks.  It might be
+ * truncated to 32 bits, but no timeout expires further than that from
+ * curr_tick.
+ */
+static uint64_t wheel_expiry(const struct _timeout *t)
+{
+	return curr_tick + (k_ticks_t)((uint64_t)t->dticks - curr_tick);
+}
+
+static int wheel_level(uint64_t expiry)
+{
+	uint64_t diff = expiry ^ curr_tick;
+	int level;
+
+	for (level = 0; level < WHEEL_LEVELS; level++) {
+		diff >>= WHEEL_BITS;
+		if (diff == 0U) {
+			break;
+		}
+	}
+
+	return level;
+}
+
+static inline int wheel_slot(uint64_t tick, int level)
+{
+	return (tick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+}
+
+static void wheel_insert(struct _timeout *t)
+{
+	uint64_t expiry = wheel_expiry(t);
+	int level = wheel_level(expiry);
+	int slot;
+
+	if (level == WHEEL_LEVELS) {
+		sys_dlist_append(&wheel_overflow, &t->node);
+		return;
+	}
+
+	slot = wheel_slot(expiry, level);
+
+	if ((wheel_used[level] & BIT64(slot)) == 0U) {
+		sys_dlist_init(&wheel[level][slot]);
+		wheel_used[level] |= BIT64(slot);
+	}
+
+	sys_dlist_append(&wheel[level][slot], &t->node);
+}
+
+static bool insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	uint64_t expiry = curr_tick + dticks;
+
+	to->dticks = (k_ticks_t)expiry;
+	wheel_insert(to);
+
+	if (wheel_first_valid && expiry >= wheel_first) {
+		return false;
+	}
+
+	/* If the first timeout is unknown, it is found when needed */
+	if (wheel_first_valid) {
+		wheel_first = expiry;
+	}
+
+	return true;
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	uint64_t expiry = wheel_expiry(t);
+	int level = wheel_level(expiry);
+	int slot = wheel_slot(expiry, level);
+
+	sys_dlist_remove(&t->node);
+
+	if (level < WHEEL_LEVELS && sys_dlist_is_empty(&wheel[level][slot])) {
+		wheel_used[level] &= ~BIT64(slot);
+	}
+
+	if (expiry == wheel_first) {
+		wheel_first_valid = false;
+	}
+}
+
+static k_ticks_t timeout_dticks(const struct _timeout *t)
+{
+	return wheel_expiry(t) - curr_tick;
+}
+
+/* Find the first timeout to expire.  Above level 0 the timeouts of a
+ * slot are unsorted, so this is linear in the number of timeouts of the
+ * first used slot, or of the overflow list.
+ */
+static struct _timeout *wheel_find_first(void)
+{
+	struct _timeout *first = NULL;
+	struct _timeout *t;
+	sys_dlist_t *list = &wheel_overflow;
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		if (wheel_used[level] == 0U) {
+			continue;
+		}
+
+		/* Slots before curr_tick are always empty */
+		list = &wheel[level][u64_count_trailing_zeros(
+					     wheel_used[level])];
+
+		/* All the timeouts of a level 0 slot expire at the same tick */
+		if (level == 0) {
+			return SYS_DLIST_PEEK_HEAD_CONTAINER(list, t, node);
+		}
+
+		break;
+	}
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+		if (first == NULL || wheel_expiry(t) < wheel_expiry(first)) {
+			first = t;
+		}
+	}
+
+	return first;
+}
+
+static k_ticks_t first_dticks(void)
+{
+	if (!wheel_first_valid) {
+		struct _timeout *first = wheel_find_first();
+
+		if (first == NULL) {
+			return K_TICKS_FOREVER;
+		}
+
+		wheel_first = wheel_expiry(first);
+		wheel_first_valid = true;
+	}
+
+	return wheel_first - curr_tick;
+}
+
+/* Move the slots that curr_tick enters at each level one level down */
+static void advance(k_ticks_t ticks)
+{
+	uint64_t prev_tick = curr_tick;
+	struct _timeout *t, *tmp;
+	sys_dnode_t *node;
+
+	curr_tick += ticks;
+
+	if ((prev_tick >> (WHEEL_BITS * WHEEL_LEVELS)) !=
+	    (curr_tick >> (WHEEL_BITS * WHEEL_LEVELS))) {
+		SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&wheel_overflow, t, tmp,
+						  node) {
+			if (wheel_level(wheel_expiry(t)) < WHEEL_LEVELS) {
+				sys_dlist_remove(&t->node);
+				wheel_insert(t);
+			}
+		}
+	}
+
+	for (int level = WHEEL_LEVELS - 1; level > 0; level--) {
+		int slot = wheel_slot(curr_tick, level);
+
+		if ((prev_tick >> (WHEEL_BITS * level)) ==
+		    (curr_tick >> (WHEEL_BITS * level)) ||
+		    (wheel_used[level] & BIT64(slot)) == 0U) {
+			continue;
+		}
+
+		wheel_used[level] &= ~BIT64(slot);
+
+		while ((node = sys_dlist_get(&wheel[level][slot])) != NULL) {
+			wheel_insert(CONTAINER_OF(node, struct _timeout, node));
+		}
+	}
+}
+
+static struct _timeout *expire_first(k_ticks_t dt)
+{
+	struct _timeout *t;
+
+	advance(dt);
+
+	/* The first timeouts are at level 0 now, in the order they were
+	 * added
+	 */
+	t = SYS_DLIST_PEEK_HEAD_CONTAINER(&wheel[0][wheel_slot(curr_tick, 0)],
+					  t, node);
+	remove_timeout(t);
+
+	return t;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+static void wheel_wakeup_min(sys_dlist_t *list, uint64_t *wakeup)
+{
+	struct _timeout *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+		uint64_t expiry = wheel_expiry(t);
+
+		if (expiry < *wakeup) {
+			*wakeup = MIN(*wakeup, expiry + t->slack);
+		}
+	}
+}
+
+/* The levels, and the slots of a level after curr_tick, are in expiry
+ * order, so only the slots starting before the wakeup found so far need
+ * to be looked at.
+ */
+static k_ticks_t wakeup_dticks(void)
+{
+	uint64_t wakeup = UINT64_MAX;
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		uint64_t period = curr_tick &
+				  ~(BIT64(WHEEL_BITS * (level + 1)) - 1U);
+		uint64_t used = wheel_used[level];
+
+		while (used != 0U) {
+			int slot = u64_count_trailing_zeros(used);
+
+			if ((period | ((uint64_t)slot << (WHEEL_BITS * level))) >=
+			    wakeup) {
+				return wakeup - curr_tick;
+			}
+
+			wheel_wakeup_min(&wheel[level][slot], &wakeup);
+			used &= used - 1U;
+		}
+	}
+
+	wheel_wakeup_min(&wheel_overflow, &wakeup);
+
+	return wakeup == UINT64_MAX ? K_TICKS_FOREVER : wakeup - curr_tick;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+#ifdef CONFIG_ZTEST
+/* Move the timeouts of a list to the end of another one, storing the ticks
+ * left until they expire in dticks.
+ */
+static void wheel_drain(sys_dlist_t *list, sys_dlist_t *queued)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+		t->dticks = timeout_dticks(t);
+		sys_dlist_append(queued, node);
+	}
+}
+
+/* Move curr_tick keeping the queued timeouts relative to it */
+static void set_tick(uint64_t tick)
+{
+	sys_dlist_t queued;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&queued);
+
+	for (int level = 0; level < WHEEL_LEVELS; level++) {
+		for (int slot = 0; slot < WHEEL_SLOTS; slot++) {
+			if ((wheel_used[level] & BIT64(slot)) != 0U) {
+				wheel_drain(&wheel[level][slot], &queued);
+			}
+		}
+
+		wheel_used[level] = 0U;
+	}
+
+	wheel_drain(&wheel_overflow, &queued);
+
+	curr_tick = tick;
+	wheel_first_valid = false;
+
+	while ((node = sys_dlist_get(&queued)) != NULL) {
+		struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+		t->dticks = (k_ticks_t)(curr_tick + t->dticks);
+		wheel_insert(t);
+	}
+}
+#endif /* CONFIG_ZTEST */
+
+#else /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -50,6 +409,28 @@ static struct _timeout *next(struct _timeout *t)
 	return n == NULL ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+static bool insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	to->dticks = dticks;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+
+	return to == first();
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -59,40 +440,165 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
-static int32_t elapsed(void)
+static k_ticks_t timeout_dticks(const struct _timeout *timeout)
 {
-	/* While sys_clock_announce() is executing, new relative timeouts will be
-	 * scheduled relatively to the currently firing timeout's original tick
-	 * value (=curr_tick) rather than relative to the current
-	 * sys_clock_elapsed().
-	 *
-	 * This means that timeouts being scheduled from within timeout callbacks
-	 * will be scheduled at well-defined offsets from the currently firing
-	 * timeout.
-	 *
-	 * As a side effect, the same will happen if an ISR with higher priority
-	 * preempts a timeout callback and schedules a timeout.
-	 *
-	 * The distinction is implemented by looking at announce_remaining which
-	 * will be non-zero while sys_clock_announce() is executing and zero
-	 * otherwise.
-	 */
-	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
 }
 
-static int32_t next_timeout(void)
+static k_ticks_t first_dticks(void)
 {
 	struct _timeout *to = first();
+
+	return to == NULL ? K_TICKS_FOREVER : to->dticks;
+}
+
+static void advance(k_ticks_t ticks)
+{
+	struct _timeout *t = first();
+
+	if (t != NULL) {
+		t->dticks -= ticks;
+	}
+
+	curr_tick += ticks;
+}
+
+static struct _timeout *expire_first(k_ticks_t dt)
+{
+	struct _timeout *t = first();
+
+	curr_tick += dt;
+	t->dticks = 0;
+	remove_timeout(t);
+
+	return t;
+}
+
+#ifdef CONFIG_TIMEOUT_SLACK
+static k_ticks_t wakeup_dticks(void)
+{
+	struct _timeout *t = first();
+	k_ticks_t ticks, wakeup;
+
+	if (t == NULL) {
+		return K_TICKS_FOREVER;
+	}
+
+	ticks = t->dticks;
+	wakeup = ticks + t->slack;
+
+	for (t = next(t); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (ticks >= wakeup) {
+			break;
+		}
+		wakeup = MIN(wakeup, ticks + t->slack);
+	}
+
+	return wakeup;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+#ifdef CONFIG_ZTEST
+static void set_tick(uint64_t tick)
+{
+	curr_tick = tick;
+}
+#endif /* CONFIG_ZTEST */
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Tick the system timer is set to wake up at */
+static uint64_t wakeup_tick = UINT64_MAX;
+
+static struct k_timeout_slack_stats slack_stats;
+
+/* Expiry ticks of the timeouts expired in the currently-executing
+ * sys_clock_announce(), and whether any of them had a slack
+ */
+static uint32_t announce_expiries;
+static bool announce_slack;
+
+/* A timeout that is not the first one may still have to wake the system
+ * up before the slack of the first ones ends
+ */
+static inline bool wakes_earlier(k_ticks_t dticks)
+{
+	return curr_tick + dticks < wakeup_tick;
+}
+
+static void slack_expired(const struct _timeout *t, k_ticks_t dt)
+{
+	if ((announce_expiries == 0U) || (dt != 0)) {
+		announce_expiries++;
+	}
+
+	announce_slack = announce_slack || (t->slack != 0U);
+}
+
+static void slack_announced(void)
+{
+	if (announce_expiries != 0U) {
+		slack_stats.wakeups++;
+		if (announce_slack) {
+			slack_stats.wakeups_saved += announce_expiries - 1U;
+		}
+	}
+
+	announce_expiries = 0U;
+	announce_slack = false;
+}
+#else
+static inline bool wakes_earlier(k_ticks_t dticks)
+{
+	ARG_UNUSED(dticks);
+
+	return false;
+}
+
+static inline void slack_expired(const struct _timeout *t, k_ticks_t dt)
+{
+	ARG_UNUSED(t);
+	ARG_UNUSED(dt);
+}
+
+static inline void slack_announced(void)
+{
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
+static int32_t next_timeout(void)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	k_ticks_t dticks = wakeup_dticks();
+#else
+	k_ticks_t dticks = first_dticks();
+#endif
 	int32_t ticks_elapsed = elapsed();
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if ((dticks == K_TICKS_FOREVER) ||
+	    ((int64_t)(dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, dticks - ticks_elapsed);
 	}
 
+#ifdef CONFIG_TIMEOUT_SLACK
+	wakeup_tick = (dticks == K_TICKS_FOREVER) ? UINT64_MAX
+						  : curr_tick + dticks;
+#endif
+
 	return ret;
 }
 
@@ -111,31 +617,18 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+		k_ticks_t dticks;
 
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    Z_TICK_ABS(timeout.ticks) >= 0) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
 
-			to->dticks = MAX(1, ticks);
+			dticks = MAX(1, ticks);
 		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
-		}
-
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
+			dticks = timeout.ticks + 1 + elapsed();
 		}
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
-
-		if (to == first()) {
+		if (insert_timeout(to, dticks) || wakes_earlier(dticks)) {
 			sys_clock_set_timeout(next_timeout(), false);
 		}
 	}
@@ -158,20 +651,11 @@ int z_abort_timeout(struct _timeout *to)
 /* must be locked */
 static k_ticks_t timeout_rem(const struct _timeout *timeout)
 {
-	k_ticks_t ticks = 0;
-
 	if (z_is_inactive_timeout(timeout)) {
 		return 0;
 	}
 
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks - elapsed();
+	return timeout_dticks(timeout) - elapsed();
 }
 
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
@@ -224,29 +708,21 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
-	struct _timeout *t = first();
-
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
-
-		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
+	for (k_ticks_t dt = first_dticks();
+	     (dt != K_TICKS_FOREVER) && (dt <= announce_remaining);
+	     dt = first_dticks()) {
+		struct _timeout *t = expire_first(dt);
 
+		slack_expired(t, dt);
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
 		key = k_spin_lock(&timeout_lock);
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
-
-	curr_tick += announce_remaining;
+	advance(announce_remaining);
 	announce_remaining = 0;
+	slack_announced();
 
 	sys_clock_set_timeout(next_timeout(), false);
 
@@ -257,6 +733,37 @@ void sys_clock_announce(int32_t ticks)
 #endif
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_timeout_slack_set(struct _timeout *to, k_timeout_t slack)
+{
+	__ASSERT(!K_TIMEOUT_EQ(slack, K_FOREVER) &&
+		 (Z_TICK_ABS(slack.ticks) < 0), "slack must be relative");
+
+	K_SPINLOCK(&timeout_lock) {
+		to->slack = (uint32_t)MIN(slack.ticks, UINT32_MAX);
+
+		/* The timeout may have to wake the system up earlier now */
+		if (sys_dnode_is_linked(&to->node)) {
+			sys_clock_set_timeout(next_timeout(), false);
+		}
+	}
+}
+
+void k_timeout_slack_stats_get(struct k_timeout_slack_stats *stats)
+{
+	K_SPINLOCK(&timeout_lock) {
+		*stats = slack_stats;
+	}
+}
+
+void k_timeout_slack_stats_reset(void)
+{
+	K_SPINLOCK(&timeout_lock) {
+		slack_stats = (struct k_timeout_slack_stats){ 0 };
+	}
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 int64_t sys_clock_tick_get(void)
 {
 	uint64_t t = 0U;
@@ -316,7 +823,9 @@ uint64_t sys_clock_timeout_end_calc(k_timeout_t timeout)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
-	curr_tick = tick;
+	K_SPINLOCK(&timeout_lock) {
+		set_tick(tick);
+	}
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
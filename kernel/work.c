@@ -80,6 +80,106 @@ static inline void init_flusher(struct z_work_flusher *flusher)
 /* List of pending cancellations. */
 static sys_slist_t pending_cancels;
 
+#ifdef CONFIG_WORKQUEUE_WORKERS
+/* List of pending flushes of work items on queues with worker threads. */
+static sys_slist_t pending_flushes;
+
+static inline bool queue_has_workers(struct k_work_q *queue)
+{
+	return !sys_slist_is_empty(&queue->workers);
+}
+
+/* Register a flush of a work item on a queue with worker threads.
+ *
+ * Invoked with work lock held.
+ *
+ * The flush completes when the run in progress, if any, and the queued
+ * run, if any, have completed.
+ *
+ * @param work the work item that is either queued or running
+ * @param flusher an uninitialized/unused flusher object
+ */
+static void add_flusher_locked(struct k_work *work,
+			       struct z_work_flusher *flusher)
+{
+	k_sem_init(&flusher->sem, 0, 1);
+	flusher->target = work;
+	flusher->runs = (flag_test(&work->flags, K_WORK_QUEUED_BIT) ? 1U : 0U)
+		+ (flag_test(&work->flags, K_WORK_RUNNING_BIT) ? 1U : 0U);
+	sys_slist_append(&pending_flushes, &flusher->work.node);
+}
+
+/* Account for a completed or dropped run of a work item, and release
+ * the flushes that were waiting for it.
+ *
+ * Invoked with work lock held.
+ *
+ * @param work the work item
+ */
+static void finalize_flush_locked(struct k_work *work)
+{
+	struct z_work_flusher *wf, *tmp;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&pending_flushes, wf, tmp, work.node) {
+		if ((wf->target == work) && (--wf->runs == 0U)) {
+			sys_slist_remove(&pending_flushes, prev, &wf->work.node);
+			k_sem_give(&wf->sem);
+		} else {
+			prev = &wf->work.node;
+		}
+	}
+}
+#endif /* CONFIG_WORKQUEUE_WORKERS */
+
+/* Test whether the current thread is one of the threads of a queue.
+ *
+ * @param queue the queue
+ */
+static inline bool queue_thread_is_current(struct k_work_q *queue)
+{
+	if (_current == &queue->thread) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	struct k_work_queue_worker *worker;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (_current == &worker->thread) {
+			return true;
+		}
+	}
+#endif
+
+	return false;
+}
+
+/* Test whether a queue has work items waiting to be run.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue
+ */
+static inline bool queue_has_pending_locked(struct k_work_q *queue)
+{
+	if (!sys_slist_is_empty(&queue->pending)) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	struct k_work_queue_worker *worker;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (!sys_slist_is_empty(&worker->pending)) {
+			return true;
+		}
+	}
+#endif
+
+	return false;
+}
+
 /* Initialize a canceler record and add it to the list of pending
  * cancels.
  *
@@ -203,10 +303,76 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
+#ifdef CONFIG_WORKQUEUE_WORKERS
+		if (queue_has_workers(queue)) {
+			struct k_work_queue_worker *worker;
+
+			/* A running item is requeued only when it completes,
+			 * so it is on no list.
+			 */
+			if (!flag_test(&work->flags, K_WORK_RUNNING_BIT) &&
+			    !sys_slist_find_and_remove(&queue->pending,
+						       &work->node)) {
+				SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers,
+							     worker, node) {
+					if (sys_slist_find_and_remove(
+						    &worker->pending,
+						    &work->node)) {
+						break;
+					}
+				}
+			}
+
+			/* The queued run will not happen */
+			finalize_flush_locked(work);
+			return;
+		}
+#endif
 		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
 	}
 }
 
+/* Add a work item to the list of a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue
+ * @param work the work item
+ */
+static inline void queue_append_locked(struct k_work_q *queue,
+				       struct k_work *work)
+{
+	sys_slist_t *pending = &queue->pending;
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	struct k_work_queue_worker *worker;
+
+	/* Running items are requeued by their thread when they complete,
+	 * so that they never run on two threads at once.
+	 */
+	if (queue_has_workers(queue) &&
+	    flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+		return;
+	}
+
+	/* Prefer the list of the submitting worker, then that of the
+	 * worker pinned to the current CPU.
+	 */
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if ((_current == &worker->thread) && !k_is_in_isr()) {
+			pending = &worker->pending;
+			break;
+		}
+		if ((worker->cpu == _current_cpu->id) &&
+		    (pending == &queue->pending)) {
+			pending = &worker->pending;
+		}
+	}
+#endif
+
+	sys_slist_append(pending, &work->node);
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -256,7 +422,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret = -EBUSY;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = queue_thread_is_current(queue) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -274,7 +440,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
-		sys_slist_append(&queue->pending, &work->node);
+		queue_append_locked(queue, work);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -438,6 +604,13 @@ static bool work_flush_locked(struct k_work *work,
 
 		__ASSERT_NO_MSG(queue != NULL);
 
+#ifdef CONFIG_WORKQUEUE_WORKERS
+		if (queue_has_workers(queue)) {
+			add_flusher_locked(work, flusher);
+			return need_flush;
+		}
+#endif
+
 		queue_flusher_locked(queue, work, flusher);
 		notify_queue_locked(queue);
 	}
@@ -592,13 +765,55 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+/* Take the next work item for a queue thread.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue
+ * @param pending the list of the thread
+ *
+ * @return the list node of the work item, or NULL if there is none
+ */
+static inline sys_snode_t *queue_get_locked(struct k_work_q *queue,
+					    sys_slist_t *pending)
+{
+	sys_snode_t *node = sys_slist_get(pending);
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	struct k_work_queue_worker *worker;
+
+	/* Steal the oldest item of another thread */
+	if (node == NULL) {
+		node = sys_slist_get(&queue->pending);
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (node != NULL) {
+			break;
+		}
+		node = sys_slist_get(&worker->pending);
+	}
+#endif
+
+	return node;
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
+ * @param worker_ptr pointer to the worker structure, or NULL for the
+ * queue thread
  */
-static void work_queue_main(void *workq_ptr, void *p2, void *p3)
+static void work_queue_main(void *workq_ptr, void *worker_ptr, void *p3)
 {
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
+	sys_slist_t *pending = &queue->pending;
+
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	if (worker_ptr != NULL) {
+		pending = &((struct k_work_queue_worker *)worker_ptr)->pending;
+	}
+#endif
 
 	while (true) {
 		sys_snode_t *node;
@@ -608,12 +823,15 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_get_locked(queue, pending);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#ifdef CONFIG_WORKQUEUE_WORKERS
+			queue->running++;
+#endif
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -631,7 +849,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -679,7 +898,22 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#ifdef CONFIG_WORKQUEUE_WORKERS
+		if (queue_has_workers(queue)) {
+			finalize_flush_locked(work);
+
+			/* Run it again if it was submitted while running */
+			if (flag_test(&work->flags, K_WORK_QUEUED_BIT)) {
+				sys_slist_append(pending, &work->node);
+			}
+		}
+
+		if (--queue->running == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -719,6 +953,10 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#ifdef CONFIG_WORKQUEUE_WORKERS
+	sys_slist_init(&queue->workers);
+	queue->running = 0U;
+#endif
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -743,6 +981,56 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_WORKERS
+void k_work_queue_add_worker(struct k_work_q *queue,
+			     struct k_work_queue_worker *worker,
+			     k_thread_stack_t *stack,
+			     size_t stack_size,
+			     int cpu)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(worker);
+	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Items queued or running before the first worker was added do
+	 * not follow the rules that keep them from running concurrently.
+	 */
+	__ASSERT(queue_has_workers(queue) ||
+		 ((queue->running == 0U) && !queue_has_pending_locked(queue)),
+		 "work submitted before the first worker was added");
+
+	sys_slist_init(&worker->pending);
+	worker->cpu = cpu;
+	sys_slist_append(&queue->workers, &worker->node);
+
+	k_spin_unlock(&lock, key);
+
+	(void)k_thread_create(&worker->thread, stack, stack_size,
+			      work_queue_main, queue, worker, NULL,
+			      k_thread_priority_get(&queue->thread), 0,
+			      K_FOREVER);
+
+	const char *name = k_thread_name_get(&queue->thread);
+
+	if (name != NULL) {
+		k_thread_name_set(&worker->thread, name);
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (cpu >= 0) {
+		(void)k_thread_cpu_pin(&worker->thread, cpu);
+	}
+#else
+	__ASSERT(cpu < 0, "pinning requires CONFIG_SCHED_CPU_MASK");
+#endif
+
+	k_thread_start(&worker->thread);
+}
+#endif /* CONFIG_WORKQUEUE_WORKERS */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -757,7 +1045,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || queue_has_pending_locked(queue)) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -843,6 +1131,16 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_INIT(k_work_delayable, dwork);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	z_timeout_slack_set(&dwork->timeout, slack);
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 static inline int work_delayable_busy_get_locked(const struct k_work_delayable *dwork)
 {
 	return flags_get(&dwork->work.flags) & K_WORK_MASK;
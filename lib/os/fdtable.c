@@ -62,6 +62,9 @@ static struct fd_entry fdtable[CONFIG_POSIX_MAX_FDS] = {
 
 static K_MUTEX_DEFINE(fdtable_lock);
 
+/* Appended under fdtable_lock, never removed */
+static sys_slist_t fd_close_notifiers = SYS_SLIST_STATIC_INIT(&fd_close_notifiers);
+
 static int z_fd_ref(int fd)
 {
 	return atomic_inc(&fdtable[fd].refcount) + 1;
@@ -252,6 +255,22 @@ void z_free_fd(int fd)
 	(void)z_fd_unref(fd);
 }
 
+void z_fd_close_notifier_register(struct fd_close_notifier *notifier)
+{
+	(void)k_mutex_lock(&fdtable_lock, K_FOREVER);
+	sys_slist_append(&fd_close_notifiers, &notifier->node);
+	k_mutex_unlock(&fdtable_lock);
+}
+
+void z_fd_close_notify(int fd)
+{
+	struct fd_close_notifier *notifier;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&fd_close_notifiers, notifier, node) {
+		notifier->cb(fd);
+	}
+}
+
 int z_alloc_fd(void *obj, const struct fd_op_vtable *vtable)
 {
 	int fd;
@@ -310,6 +329,8 @@ int close(int fd)
 		return -1;
 	}
 
+	z_fd_close_notify(fd);
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 
 	res = fdtable[fd].vtable->close(fdtable[fd].obj);
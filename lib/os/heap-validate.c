@@ -83,8 +83,46 @@ static void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Cached chunks are marked used but count as free */
+	for (int i = 1; i <= size_class_count(h); i++) {
+		for (c = size_class_heads(h)[i]; c != 0; c = next_free_chunk(h, c)) {
+			*alloc_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
+		}
+	}
+#endif
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+static bool valid_size_classes(struct z_heap *h)
+{
+	chunksz_t cached = 0;
+
+	if (size_class_count(h) == 0) {
+		return true;
+	}
+
+	for (int i = 1; i <= size_class_count(h); i++) {
+		for (chunkid_t c = size_class_heads(h)[i]; c != 0;
+		     c = next_free_chunk(h, c)) {
+			VALIDATE(in_bounds(h, c));
+			VALIDATE(valid_chunk(h, c));
+			VALIDATE(chunk_used(h, c));
+			VALIDATE(chunk_size(h, c) == i);
+
+			/* Also catches loops */
+			cached += i;
+			VALIDATE(cached <= size_class_max_cached(h));
+		}
+	}
+	VALIDATE(cached == size_class_heads(h)[0]);
+
+	return true;
+}
+#endif
+
 bool sys_heap_validate(struct sys_heap *heap)
 {
 	struct z_heap *h = heap->heap;
@@ -102,6 +140,12 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	if (!valid_size_classes(h)) {
+		return false;
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
@@ -148,6 +148,73 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+static inline bool size_class_chunk(struct z_heap *h, chunksz_t sz)
+{
+	return sz <= size_class_count(h);
+}
+
+/* Caches a chunk that is still marked used, if there is room */
+static bool size_class_add(struct z_heap *h, chunkid_t c)
+{
+	chunkid_t *heads = size_class_heads(h);
+	chunksz_t sz = chunk_size(h, c);
+
+	if (heads[0] + sz > size_class_max_cached(h)) {
+		return false;
+	}
+
+	set_next_free_chunk(h, c, heads[sz]);
+	heads[sz] = c;
+	heads[0] += sz;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+
+	return true;
+}
+
+static chunkid_t size_class_get(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t *heads = size_class_heads(h);
+	chunkid_t c = heads[sz];
+
+	if (c != 0U) {
+		CHECK(chunk_used(h, c) && chunk_size(h, c) == sz);
+
+		heads[sz] = next_free_chunk(h, c);
+		heads[0] -= sz;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+		h->free_bytes -= chunksz_to_bytes(h, sz);
+#endif
+	}
+
+	return c;
+}
+
+/* Returns all cached chunks to the free lists, merging them with their
+ * neighbors.  Returns true if there were any.
+ */
+static bool size_classes_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (chunksz_t sz = 1; sz <= size_class_count(h); sz++) {
+		chunkid_t c;
+
+		while ((c = size_class_get(h, sz)) != 0U) {
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+			flushed = true;
+		}
+	}
+
+	return flushed;
+}
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -184,7 +251,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +260,16 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Chunks that would merge with a free neighbor are not cached */
+	if (size_class_chunk(h, chunk_size(h, c)) &&
+	    chunk_used(h, left_chunk(h, c)) &&
+	    chunk_used(h, right_chunk(h, c)) && size_class_add(h, c)) {
+		return;
+	}
+#endif
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -257,6 +333,13 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 		return c;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* The cached chunks may merge into a big enough one */
+	if (size_classes_flush(h)) {
+		return alloc_chunk(h, sz);
+	}
+#endif
+
 	return 0;
 }
 
@@ -270,18 +353,28 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
-	if (c == 0U) {
-		return NULL;
-	}
+	chunkid_t c = 0U;
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	if (size_class_chunk(h, chunk_sz)) {
+		c = size_class_get(h, chunk_sz);
 	}
+#endif
 
-	set_chunk_used(h, c, true);
+	if (c == 0U) {
+		c = alloc_chunk(h, chunk_sz);
+		if (c == 0U) {
+			return NULL;
+		}
+
+		/* Split off remainder if any */
+		if (chunk_size(h, c) > chunk_sz) {
+			split_chunks(h, c, c + chunk_sz);
+			free_list_add(h, c + chunk_sz);
+		}
+
+		set_chunk_used(h, c, true);
+	}
 
 	mem = chunk_mem(h, c);
 
@@ -518,8 +611,18 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 #endif
 
 	int nb_buckets = bucket_idx(h, heap_sz) + 1;
+	size_t nb_size_classes = 0;
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	if (size_class_count(h) > 0) {
+		/* The heads plus the count of cached units */
+		nb_size_classes = size_class_count(h) + 1;
+	}
+#endif
+
 	chunksz_t chunk0_size = chunksz(sizeof(struct z_heap) +
-				     nb_buckets * sizeof(struct z_heap_bucket));
+				     nb_buckets * sizeof(struct z_heap_bucket) +
+				     nb_size_classes * sizeof(chunkid_t));
 
 	__ASSERT(chunk0_size + min_chunk_size(h) <= heap_sz, "heap size is too small");
 
@@ -527,6 +630,12 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	for (int i = 0; i < nb_size_classes; i++) {
+		size_class_heads(h)[i] = 0;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
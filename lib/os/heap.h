@@ -253,6 +253,34 @@ static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 	return 31 - __builtin_clz(usable_sz);
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/* Freed chunks of up to this many units are cached by exact size.
+ * They stay marked used, so their neighbors never merge with them,
+ * and are singly linked through FREE_NEXT.  A heap gets one size
+ * class per 64 units and caches up to 1/16 of its units, so that
+ * deferring the merges does not fragment it much.
+ */
+#define SIZE_CLASS_MAX_CHUNKS ((CONFIG_SYS_HEAP_SIZE_CLASS_MAX_BYTES + 15U) / CHUNK_UNIT)
+
+static inline chunksz_t size_class_count(struct z_heap *h)
+{
+	return MIN(SIZE_CLASS_MAX_CHUNKS, h->end_chunk / 64U);
+}
+
+static inline chunksz_t size_class_max_cached(struct z_heap *h)
+{
+	return h->end_chunk / 16U;
+}
+
+/* Follows the buckets.  Entry 0 holds the number of cached units,
+ * entry N the list head of cached chunks of size N.
+ */
+static inline chunkid_t *size_class_heads(struct z_heap *h)
+{
+	return (chunkid_t *)&h->buckets[bucket_idx(h, h->end_chunk) + 1];
+}
+#endif
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
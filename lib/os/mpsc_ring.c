@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/mpsc_ring.h>
+#include <string.h>
+
+/* Sequence numbers are stored relative to the element index, so that a
+ * zeroed ring is valid. For the element at index i = pos & mask:
+ *
+ * - seq == pos - i: free, may be claimed by the producer at position pos,
+ * - seq == pos - i + 1: committed at position pos,
+ * - seq == pos - i + N: freed by the consumer, for position pos + N.
+ */
+
+static inline uint32_t elem_idx(struct mpsc_ring *ring, void *elem)
+{
+	return ((uint8_t *)elem - ring->buf) / ring->elem_size;
+}
+
+static inline void *elem_ptr(struct mpsc_ring *ring, uint32_t pos)
+{
+	return ring->buf + (size_t)(pos & ring->mask) * ring->elem_size;
+}
+
+static inline int32_t seq_diff(struct mpsc_ring *ring, uint32_t pos,
+			       uint32_t expected)
+{
+	uint32_t idx = pos & ring->mask;
+	uint32_t seq = (uint32_t)atomic_get(&ring->seq[idx]);
+
+	return (int32_t)(seq - (pos - idx + expected));
+}
+
+void mpsc_ring_init(struct mpsc_ring *ring, void *buf, atomic_t *seq,
+		    size_t elem_size, uint32_t num_elems, uint32_t flags)
+{
+	int err;
+
+	__ASSERT_NO_MSG(is_power_of_two(num_elems) && (num_elems >= 2));
+
+	ring->buf = buf;
+	ring->seq = seq;
+	ring->elem_size = elem_size;
+	ring->mask = num_elems - 1;
+	ring->flags = flags;
+	atomic_clear(&ring->wr_idx);
+	atomic_clear(&ring->rd_idx);
+
+	for (uint32_t i = 0; i < num_elems; i++) {
+		atomic_clear(&seq[i]);
+	}
+
+	err = k_sem_init(&ring->sem, 0, 1);
+	__ASSERT_NO_MSG(err == 0);
+	ARG_UNUSED(err);
+}
+
+void *mpsc_ring_put_claim(struct mpsc_ring *ring)
+{
+	uint32_t pos = (uint32_t)atomic_get(&ring->wr_idx);
+
+	if (ring->flags & MPSC_RING_SINGLE_PRODUCER) {
+		if (seq_diff(ring, pos, 0) != 0) {
+			return NULL;
+		}
+
+		atomic_set(&ring->wr_idx, (atomic_val_t)(pos + 1));
+		return elem_ptr(ring, pos);
+	}
+
+	for (;;) {
+		int32_t diff = seq_diff(ring, pos, 0);
+
+		if (diff < 0) {
+			/* Not yet freed on the previous lap */
+			return NULL;
+		}
+
+		if ((diff == 0) &&
+		    atomic_cas(&ring->wr_idx, (atomic_val_t)pos,
+			       (atomic_val_t)(pos + 1))) {
+			return elem_ptr(ring, pos);
+		}
+
+		/* Claimed by another producer, try the next position */
+		pos = (uint32_t)atomic_get(&ring->wr_idx);
+	}
+}
+
+void mpsc_ring_put_commit(struct mpsc_ring *ring, void *elem)
+{
+	uint32_t idx = elem_idx(ring, elem);
+	uint32_t seq = (uint32_t)atomic_get(&ring->seq[idx]);
+
+	atomic_set(&ring->seq[idx], (atomic_val_t)(seq + 1));
+
+	/* The consumer may be waiting only if this is the element it reads
+	 * next. Both sides store before loading what the other one stores,
+	 * so either the consumer sees the commit or this sees its position.
+	 */
+	if (((uint32_t)atomic_get(&ring->rd_idx) & ring->mask) == idx) {
+		k_sem_give(&ring->sem);
+	}
+}
+
+int mpsc_ring_put(struct mpsc_ring *ring, const void *data)
+{
+	void *elem = mpsc_ring_put_claim(ring);
+
+	if (elem == NULL) {
+		return -ENOMEM;
+	}
+
+	memcpy(elem, data, ring->elem_size);
+	mpsc_ring_put_commit(ring, elem);
+
+	return 0;
+}
+
+bool mpsc_ring_is_pending(struct mpsc_ring *ring)
+{
+	return seq_diff(ring, (uint32_t)atomic_get(&ring->rd_idx), 1) == 0;
+}
+
+void *mpsc_ring_get_claim(struct mpsc_ring *ring, k_timeout_t timeout)
+{
+	uint64_t end = sys_clock_timeout_end_calc(timeout);
+
+	__ASSERT(!k_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	while (!mpsc_ring_is_pending(ring)) {
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+		    !K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+			int64_t remaining = end - sys_clock_tick_get();
+
+			if (remaining <= 0) {
+				return NULL;
+			}
+
+			timeout = Z_TIMEOUT_TICKS(remaining);
+		}
+
+		/* The semaphore may still be available from an earlier
+		 * commit, in which case the ring is simply checked again.
+		 */
+		if (k_sem_take(&ring->sem, timeout) != 0) {
+			return NULL;
+		}
+	}
+
+	return elem_ptr(ring, (uint32_t)atomic_get(&ring->rd_idx));
+}
+
+void mpsc_ring_free(struct mpsc_ring *ring, void *elem)
+{
+	uint32_t pos = (uint32_t)atomic_get(&ring->rd_idx);
+	uint32_t idx = pos & ring->mask;
+
+	__ASSERT(elem_idx(ring, elem) == idx, "Freeing unclaimed element");
+	ARG_UNUSED(elem);
+
+	atomic_set(&ring->seq[idx],
+		   (atomic_val_t)(pos - idx + ring->mask + 1));
+	atomic_set(&ring->rd_idx, (atomic_val_t)(pos + 1));
+}
+
+int mpsc_ring_get(struct mpsc_ring *ring, void *data, k_timeout_t timeout)
+{
+	void *elem = mpsc_ring_get_claim(ring, timeout);
+
+	if (elem == NULL) {
+		return K_TIMEOUT_EQ(timeout, K_NO_WAIT) ? -ENOMSG : -EAGAIN;
+	}
+
+	memcpy(data, elem, ring->elem_size);
+	mpsc_ring_free(ring, elem);
+
+	return 0;
+}
@@ -48,6 +48,9 @@ LOG_MODULE_REGISTER(net_coap_server_sample, LOG_LEVEL_DBG);
 
 #define NUM_PENDINGS 10
 
+/* Enough for the path segments of all the resources */
+#define NUM_ROUTER_NODES 32
+
 /* CoAP socket fd */
 static int sock;
 
@@ -1320,6 +1323,9 @@ static struct coap_resource resources[] = {
 	{ },
 };
 
+static struct coap_router_node router_nodes[NUM_ROUTER_NODES];
+static struct coap_router router;
+
 static struct coap_resource *find_resource_by_observer(
 		struct coap_resource *resources, struct coap_observer *o)
 {
@@ -1397,8 +1403,8 @@ static void process_coap_request(uint8_t *data, uint16_t data_len,
 	return;
 
 not_found:
-	r = coap_handle_request(&request, resources, options, opt_num,
-				client_addr, client_addr_len);
+	r = coap_router_handle_request(&router, &request, options, opt_num,
+				       client_addr, client_addr_len);
 	if (r < 0) {
 		LOG_WRN("No handler for such request (%d)\n", r);
 	}
@@ -1433,6 +1439,13 @@ int main(void)
 
 	LOG_DBG("Start CoAP-server sample");
 
+	r = coap_router_init(&router, resources, router_nodes,
+			     ARRAY_SIZE(router_nodes));
+	if (r < 0) {
+		LOG_ERR("Cannot initialize resource router (%d)", r);
+		goto quit;
+	}
+
 #if defined(CONFIG_NET_IPV6)
 	bool res;
 
@@ -784,9 +784,11 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. Packets that
+	 * are split into TCP segments before sending are not fragmented.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U &&
+	    net_pkt_gso_size(pkt) == 0U) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
@@ -238,6 +238,9 @@ int net_context_get(sa_family_t family, enum net_sock_type type, uint16_t proto,
 		    struct net_context **context)
 {
 	int i, ret;
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+	uint32_t generation;
+#endif
 
 	if (IS_ENABLED(CONFIG_NET_CONTEXT_CHECK)) {
 		ret = net_context_check(family, type, proto, context);
@@ -254,7 +257,16 @@ int net_context_get(sa_family_t family, enum net_sock_type type, uint16_t proto,
 			continue;
 		}
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+		generation = contexts[i].generation + 1U;
+#endif
+
 		memset(&contexts[i], 0, sizeof(contexts[i]));
+
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+		contexts[i].generation = generation;
+#endif
+
 		/* FIXME - Figure out a way to get the correct network interface
 		 * as it is not known at this point yet.
 		 */
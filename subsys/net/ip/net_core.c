@@ -129,6 +129,14 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
+		/* TCP segments can be held back here to be merged with
+		 * the following segments of the same connection.
+		 */
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO) && !is_loopback &&
+		    !locally_routed && net_tcp_gro_receive(pkt)) {
+			return NET_OK;
+		}
+
 		/* IP version and header length. */
 		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
 
@@ -387,12 +395,21 @@ void net_process_rx_packet(struct net_pkt *pkt)
 static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 {
 	uint8_t prio = net_pkt_priority(pkt);
-	uint8_t tc = net_rx_priority2tc(prio);
+	uint8_t tc;
+
+	if (IS_ENABLED(CONFIG_NET_TC_RX_FLOW_STEERING)) {
+		tc = net_tc_rx_flow_steer(iface, pkt);
+	} else {
+		tc = net_rx_priority2tc(prio);
+	}
 
 #if defined(CONFIG_NET_STATISTICS)
 	net_stats_update_tc_recv_pkt(iface, tc);
 	net_stats_update_tc_recv_bytes(iface, tc, net_pkt_get_len(pkt));
-	net_stats_update_tc_recv_priority(iface, tc, prio);
+
+	if (!IS_ENABLED(CONFIG_NET_TC_RX_FLOW_STEERING)) {
+		net_stats_update_tc_recv_priority(iface, tc, prio);
+	}
 #endif
 
 #if NET_TC_RX_COUNT > 1
@@ -263,7 +263,12 @@ static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 			}
 		}
 
-		status = net_if_l2(iface)->send(iface, pkt);
+		if (IS_ENABLED(CONFIG_NET_TCP_GSO) &&
+		    net_pkt_gso_size(pkt) > 0U) {
+			status = net_tcp_gso_send(iface, pkt);
+		} else {
+			status = net_if_l2(iface)->send(iface, pkt);
+		}
 
 		if (IS_ENABLED(CONFIG_NET_PKT_TXTIME_STATS)) {
 			uint32_t end_tick = k_cycle_get_32();
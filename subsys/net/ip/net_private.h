@@ -93,8 +93,37 @@ static inline enum net_verdict net_ipv6_input(struct net_pkt *pkt,
 #endif
 extern bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt);
 extern void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt);
+extern uint8_t net_tc_rx_flow_steer(struct net_if *iface,
+				    struct net_pkt *pkt);
+extern int net_tc_rx_current_queue(void);
 extern enum net_verdict net_promisc_mode_input(struct net_pkt *pkt);
 
+#if defined(CONFIG_NET_TCP_GRO)
+bool net_tcp_gro_receive(struct net_pkt *pkt);
+void net_tcp_gro_flush(void);
+#else
+static inline bool net_tcp_gro_receive(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void net_tcp_gro_flush(void) { }
+#endif /* CONFIG_NET_TCP_GRO */
+
+#if defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt);
+#else
+static inline int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+
+	return -ENOTSUP;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 char *net_sprint_addr(sa_family_t af, const void *addr);
 
 #define net_sprint_ipv4_addr(_addr) net_sprint_addr(AF_INET, _addr)
@@ -2205,6 +2205,15 @@ static void print_dns_info(const struct shell *sh,
 			   remaining);
 		}
 	}
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	struct dns_cache_stats stats;
+
+	dns_cache_get_stats(&stats);
+
+	PR("Cache: %u entries, %u hits, %u misses\n", stats.entries,
+	   stats.hits, stats.misses);
+#endif
 }
 #endif
 
@@ -13,10 +13,13 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/ppp.h>
 
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "ipv4.h"
 
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
@@ -72,6 +75,183 @@ void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 }
 
+int net_tc_rx_current_queue(void)
+{
+#if NET_TC_RX_COUNT > 0
+	k_tid_t tid = k_current_get();
+
+	for (int i = 0; i < NET_TC_RX_COUNT; i++) {
+		if (tid == &rx_classes[i].handler) {
+			return i;
+		}
+	}
+#endif
+	return -1;
+}
+
+#if defined(CONFIG_NET_TC_RX_FLOW_STEERING)
+/* Enough for a VLAN tagged Ethernet header, an IPv6 header and the
+ * transport layer ports.
+ */
+#define FLOW_HDR_MAX_LEN (sizeof(struct net_eth_vlan_hdr) + \
+			  sizeof(struct net_ipv6_hdr) + 2 * sizeof(uint16_t))
+
+#define FLOW_HASH_INIT 2166136261U
+
+/* FNV-1a */
+static uint32_t flow_hash_update(uint32_t hash, const uint8_t *data,
+				 size_t len)
+{
+	while (len--) {
+		hash ^= *data++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+/* Return the offset of the IP header, or -1 if the packet is not IP. */
+static int flow_l3_offset(struct net_if *iface, const uint8_t *hdr,
+			  size_t len)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		const struct net_eth_hdr *eth = (const struct net_eth_hdr *)hdr;
+		int offset = sizeof(struct net_eth_hdr);
+		uint16_t type;
+
+		if (len < sizeof(struct net_eth_hdr)) {
+			return -1;
+		}
+
+		type = ntohs(eth->type);
+
+		if (type == NET_ETH_PTYPE_VLAN) {
+			const struct net_eth_vlan_hdr *vlan =
+				(const struct net_eth_vlan_hdr *)hdr;
+
+			if (len < sizeof(struct net_eth_vlan_hdr)) {
+				return -1;
+			}
+
+			type = ntohs(vlan->type);
+			offset = sizeof(struct net_eth_vlan_hdr);
+		}
+
+		if (type != NET_ETH_PTYPE_IP && type != NET_ETH_PTYPE_IPV6) {
+			return -1;
+		}
+
+		return offset;
+	}
+#endif
+
+#if defined(CONFIG_NET_L2_PPP)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(PPP)) {
+		uint16_t protocol;
+
+		if (len < sizeof(protocol)) {
+			return -1;
+		}
+
+		/* The PPP L2 strips the protocol field only later on */
+		protocol = sys_get_be16(hdr);
+		if (protocol != PPP_IP && protocol != PPP_IPV6) {
+			return -1;
+		}
+
+		return sizeof(protocol);
+	}
+#endif
+
+#if !defined(CONFIG_NET_L2_ETHERNET) && !defined(CONFIG_NET_L2_PPP)
+	ARG_UNUSED(iface);
+#endif
+
+	/* Other L2s pass the IP packet as is */
+	return 0;
+}
+
+static uint32_t flow_hash(struct net_if *iface, struct net_pkt *pkt)
+{
+	uint8_t hdr[FLOW_HDR_MAX_LEN];
+	struct net_pkt_cursor backup;
+	uint32_t hash = FLOW_HASH_INIT;
+	size_t len;
+	size_t l4_offset;
+	size_t offset;
+	uint8_t proto;
+	int ret;
+
+	len = MIN(net_pkt_get_len(pkt), sizeof(hdr));
+
+	net_pkt_cursor_backup(pkt, &backup);
+	ret = net_pkt_read(pkt, hdr, len);
+	net_pkt_cursor_restore(pkt, &backup);
+
+	if (ret < 0) {
+		return 0;
+	}
+
+	ret = flow_l3_offset(iface, hdr, len);
+	if (ret < 0 || (size_t)ret >= len) {
+		return 0;
+	}
+
+	offset = ret;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && (hdr[offset] & 0xf0) == 0x40 &&
+	    len >= offset + sizeof(struct net_ipv4_hdr)) {
+		const struct net_ipv4_hdr *ip =
+			(const struct net_ipv4_hdr *)&hdr[offset];
+
+		hash = flow_hash_update(hash, ip->src, 2 * NET_IPV4_ADDR_SIZE);
+		hash = flow_hash_update(hash, &ip->proto, sizeof(ip->proto));
+
+		/* Only the first fragment carries the ports. Fragments
+		 * must stay in order with each other, so leave the ports
+		 * out for all of them.
+		 */
+		if ((ip->offset[0] & 0x3f) || ip->offset[1]) {
+			return hash;
+		}
+
+		proto = ip->proto;
+		l4_offset = offset + (ip->vhl & NET_IPV4_IHL_MASK) * 4U;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   (hdr[offset] & 0xf0) == 0x60 &&
+		   len >= offset + sizeof(struct net_ipv6_hdr)) {
+		const struct net_ipv6_hdr *ip =
+			(const struct net_ipv6_hdr *)&hdr[offset];
+
+		hash = flow_hash_update(hash, ip->src, 2 * NET_IPV6_ADDR_SIZE);
+		hash = flow_hash_update(hash, &ip->nexthdr,
+					sizeof(ip->nexthdr));
+
+		/* Ports are only looked up if no extension header is
+		 * present, fragments included.
+		 */
+		proto = ip->nexthdr;
+		l4_offset = offset + sizeof(struct net_ipv6_hdr);
+	} else {
+		return 0;
+	}
+
+	if ((proto == IPPROTO_TCP || proto == IPPROTO_UDP) &&
+	    len >= l4_offset + 2 * sizeof(uint16_t)) {
+		hash = flow_hash_update(hash, &hdr[l4_offset],
+					2 * sizeof(uint16_t));
+	}
+
+	return hash;
+}
+
+uint8_t net_tc_rx_flow_steer(struct net_if *iface, struct net_pkt *pkt)
+{
+	return flow_hash(iface, pkt) % NET_TC_RX_COUNT;
+}
+#endif /* CONFIG_NET_TC_RX_FLOW_STEERING */
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_TX_COUNT > 0
@@ -242,7 +422,21 @@ static void tc_rx_handler(struct k_fifo *fifo)
 	struct net_pkt *pkt;
 
 	while (1) {
-		pkt = k_fifo_get(fifo, K_FOREVER);
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO)) {
+			pkt = k_fifo_get(fifo, K_NO_WAIT);
+			if (pkt == NULL) {
+				/* The queue is empty, so there is nothing
+				 * to merge with anymore. Pass up the TCP
+				 * segments collected so far.
+				 */
+				net_tcp_gro_flush();
+
+				pkt = k_fifo_get(fifo, K_FOREVER);
+			}
+		} else {
+			pkt = k_fifo_get(fifo, K_FOREVER);
+		}
+
 		if (pkt == NULL) {
 			continue;
 		}
@@ -340,7 +534,9 @@ void net_tc_rx_init(void)
 	BUILD_ASSERT(NET_TC_RX_COUNT >= 0);
 
 #if defined(CONFIG_NET_STATISTICS)
-	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
+	if (!IS_ENABLED(CONFIG_NET_TC_RX_FLOW_STEERING)) {
+		net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
+	}
 #endif
 
 	for (i = 0; i < NET_TC_RX_COUNT; i++) {
@@ -348,7 +544,11 @@ void net_tc_rx_init(void)
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		/* With flow steering, the queues are not ordered by
+		 * priority but share the load equally.
+		 */
+		thread_priority = IS_ENABLED(CONFIG_NET_TC_RX_FLOW_STEERING) ?
+			rx_tc2thread(0) : rx_tc2thread(i);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -382,6 +582,10 @@ void net_tc_rx_init(void)
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_TC_RX_FLOW_STEERING_CPU_PIN)
+		(void)k_thread_cpu_pin(tid, i % arch_num_cpus());
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -256,6 +256,215 @@ static int nbr_nexthop_put(struct net_nbr *nbr)
 }
 
 
+/* Routes are indexed by their prefix in a path compressed binary trie,
+ * so that the longest prefix match does not need to go through the whole
+ * routing table. Each trie node holds the routes (one per interface) for
+ * exactly its prefix. Nodes without routes are only kept as branching
+ * points, so the trie never needs more than two nodes per route.
+ */
+struct route_trie_node {
+	struct route_trie_node *parent;
+	struct route_trie_node *child[2];
+
+	/** Routes with this prefix */
+	sys_slist_t routes;
+
+	/** Prefix of the node, bits after the prefix length are zero */
+	struct in6_addr prefix;
+	uint8_t prefix_len;
+};
+
+static struct route_trie_node route_trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_trie_node route_trie_root;
+static struct route_trie_node *route_trie_free;
+
+static inline int prefix_bit(const struct in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8U] >> (7U - bit % 8U)) & 1;
+}
+
+static uint8_t common_prefix_len(const struct in6_addr *addr1,
+				 const struct in6_addr *addr2,
+				 uint8_t max_len)
+{
+	uint8_t len;
+
+	for (len = 0U; len < max_len; len += 8U) {
+		uint8_t diff = addr1->s6_addr[len / 8U] ^ addr2->s6_addr[len / 8U];
+
+		if (diff) {
+			len += __builtin_clz(diff) - (32 - 8);
+			break;
+		}
+	}
+
+	return MIN(len, max_len);
+}
+
+static void route_trie_init(void)
+{
+	int i;
+
+	route_trie_free = NULL;
+
+	for (i = 0; i < ARRAY_SIZE(route_trie_nodes); i++) {
+		route_trie_nodes[i].child[0] = route_trie_free;
+		route_trie_free = &route_trie_nodes[i];
+	}
+}
+
+static struct route_trie_node *route_trie_node_alloc(const struct in6_addr *addr,
+						     uint8_t prefix_len)
+{
+	struct route_trie_node *node = route_trie_free;
+	uint8_t bytes = prefix_len / 8U;
+
+	if (!node) {
+		return NULL;
+	}
+
+	route_trie_free = node->child[0];
+
+	memset(node, 0, sizeof(*node));
+	memcpy(node->prefix.s6_addr, addr->s6_addr, bytes);
+
+	if (prefix_len % 8U) {
+		node->prefix.s6_addr[bytes] = addr->s6_addr[bytes] &
+					      (0xff << (8U - prefix_len % 8U));
+	}
+
+	node->prefix_len = prefix_len;
+
+	return node;
+}
+
+static void route_trie_node_link(struct route_trie_node *parent,
+				 struct route_trie_node *child)
+{
+	parent->child[prefix_bit(&child->prefix, parent->prefix_len)] = child;
+	child->parent = parent;
+}
+
+/* Remove nodes that have no routes and are not needed for branching */
+static void route_trie_prune(struct route_trie_node *node)
+{
+	while (node != &route_trie_root && sys_slist_is_empty(&node->routes) &&
+	       !(node->child[0] && node->child[1])) {
+		struct route_trie_node *parent = node->parent;
+		struct route_trie_node *child;
+
+		child = node->child[0] ? node->child[0] : node->child[1];
+		if (child) {
+			route_trie_node_link(parent, child);
+		} else {
+			parent->child[parent->child[1] == node] = NULL;
+		}
+
+		node->child[0] = route_trie_free;
+		route_trie_free = node;
+
+		node = parent;
+	}
+}
+
+static int route_trie_insert(struct net_route_entry *route)
+{
+	struct route_trie_node *node = &route_trie_root;
+	struct route_trie_node *child, *new_node;
+	sys_snode_t *cur, *prev = NULL;
+	uint8_t len;
+
+	while (node->prefix_len < route->prefix_len) {
+		child = node->child[prefix_bit(&route->addr, node->prefix_len)];
+		if (!child) {
+			len = route->prefix_len;
+		} else {
+			len = common_prefix_len(&route->addr, &child->prefix,
+						MIN(route->prefix_len,
+						    child->prefix_len));
+			if (len == child->prefix_len) {
+				node = child;
+				continue;
+			}
+		}
+
+		/* Either a new leaf, or a node splitting the path to the
+		 * existing child at the point where the prefixes diverge.
+		 */
+		new_node = route_trie_node_alloc(&route->addr, len);
+		if (!new_node) {
+			route_trie_prune(node);
+			return -ENOMEM;
+		}
+
+		if (child) {
+			route_trie_node_link(new_node, child);
+		}
+
+		route_trie_node_link(node, new_node);
+		node = new_node;
+	}
+
+	/* Keep the routes sorted by their slot in the pool, highest first.
+	 * On a lookup on any interface, the route in the highest slot wins
+	 * among those with the same prefix, as it did when the pool was
+	 * scanned in order.
+	 */
+	SYS_SLIST_FOR_EACH_NODE(&node->routes, cur) {
+		if (CONTAINER_OF(cur, struct net_route_entry, prefix_node) < route) {
+			break;
+		}
+
+		prev = cur;
+	}
+
+	sys_slist_insert(&node->routes, prev, &route->prefix_node);
+
+	return 0;
+}
+
+static void route_trie_remove(struct net_route_entry *route)
+{
+	struct route_trie_node *node = &route_trie_root;
+
+	while (node && node->prefix_len < route->prefix_len) {
+		node = node->child[prefix_bit(&route->addr, node->prefix_len)];
+	}
+
+	if (!node || node->prefix_len != route->prefix_len) {
+		return;
+	}
+
+	if (sys_slist_find_and_remove(&node->routes, &route->prefix_node)) {
+		route_trie_prune(node);
+	}
+}
+
+static struct net_route_entry *route_trie_lookup(struct net_if *iface,
+						 struct in6_addr *dst)
+{
+	struct route_trie_node *node = &route_trie_root;
+	struct net_route_entry *route, *found = NULL;
+
+	while (node && net_ipv6_is_prefix(dst->s6_addr, node->prefix.s6_addr,
+					  node->prefix_len)) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, prefix_node) {
+			if (!iface || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->prefix_len == 128U) {
+			break;
+		}
+
+		node = node->child[prefix_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+
 #define net_route_info(str, route, dst)					\
 	do {								\
 	if (CONFIG_NET_ROUTE_LOG_LEVEL >= LOG_LEVEL_DBG) {		\
@@ -279,33 +488,11 @@ static inline void update_route_access(struct net_route_entry *route)
 struct net_route_entry *net_route_lookup(struct net_if *iface,
 					 struct in6_addr *dst)
 {
-	struct net_route_entry *route, *found = NULL;
-	uint8_t longest_match = 0U;
-	int i;
+	struct net_route_entry *found;
 
 	k_mutex_lock(&lock, K_FOREVER);
 
-	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
-		struct net_nbr *nbr = get_nbr(i);
-
-		if (!nbr->ref) {
-			continue;
-		}
-
-		if (iface && nbr->iface != iface) {
-			continue;
-		}
-
-		route = net_route_data(nbr);
-
-		if (route->prefix_len >= longest_match &&
-		    net_ipv6_is_prefix(dst->s6_addr,
-				       route->addr.s6_addr,
-				       route->prefix_len)) {
-			found = route;
-			longest_match = route->prefix_len;
-		}
-	}
+	found = route_trie_lookup(iface, dst);
 
 	if (found) {
 		net_route_info("Found", found, dst);
@@ -354,6 +541,11 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 		return NULL;
 	}
 
+	if (prefix_len > 128) {
+		NET_DBG("Invalid prefix length %d", prefix_len);
+		return NULL;
+	}
+
 	k_mutex_lock(&lock, K_FOREVER);
 
 	nbr_nexthop = net_ipv6_nbr_lookup(iface, nexthop);
@@ -464,6 +656,13 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	sys_slist_init(&route->nexthop);
 	sys_slist_prepend(&route->nexthop, &nexthop_route->node);
 
+	if (route_trie_insert(route) < 0) {
+		NET_ERR("Route index full!");
+		net_route_del(route);
+		route = NULL;
+		goto exit;
+	}
+
 	net_route_info("Added", route, addr);
 
 #if defined(CONFIG_NET_MGMT_EVENT_INFO)
@@ -605,6 +804,8 @@ int net_route_del(struct net_route_entry *route)
 
 	net_route_info("Deleted", route, &route->addr);
 
+	route_trie_remove(route);
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&route->nexthop, nexthop_route, node) {
 		if (!nexthop_route->nbr) {
 			continue;
@@ -1100,5 +1301,7 @@ void net_route_init(void)
 	NET_DBG("Allocated %d nexthop entries (%zu bytes)",
 		CONFIG_NET_MAX_NEXTHOPS, sizeof(net_route_nexthop_pool));
 
+	route_trie_init();
+
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
 }
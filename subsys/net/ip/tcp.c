@@ -895,6 +895,13 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 {
 	net_pkt_cursor_init(pkt);
 
+	/* Lengths and checksums are set for each segment when the packet
+	 * is split.
+	 */
+	if (net_pkt_gso_size(pkt) > 0U) {
+		return 0;
+	}
+
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
 		return net_ipv4_finalize(pkt, IPPROTO_TCP);
 	}
@@ -1048,6 +1055,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 	if (data) {
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
 		data->buffer = NULL;
 	}
 
@@ -1169,6 +1177,82 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+static bool tcp_gso_l2(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return true;
+	}
+#endif
+#if defined(CONFIG_NET_L2_PPP)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(PPP)) {
+		return true;
+	}
+#endif
+	return false;
+}
+
+static bool tcp_gso_allowed(struct tcp *conn)
+{
+	if (conn->data_mode == TCP_DATA_MODE_RESEND || !tcp_gso_l2(conn->iface)) {
+		return false;
+	}
+
+	/* Packets to a local destination are not passed to L2 */
+	if (IS_ENABLED(CONFIG_NET_IPV4) && conn->dst.sa.sa_family == AF_INET) {
+		return !net_ipv4_is_addr_loopback(&conn->dst.sin.sin_addr) &&
+		       !net_ipv4_is_my_addr(&conn->dst.sin.sin_addr);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && conn->dst.sa.sa_family == AF_INET6) {
+		return !net_ipv6_is_addr_loopback(&conn->dst.sin6.sin6_addr) &&
+		       !net_ipv6_is_my_addr(&conn->dst.sin6.sin6_addr);
+	}
+
+	return false;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
+/* Max amount of data sent in one packet. With GSO, several segments worth
+ * of data are passed down as one packet and split just before sending.
+ */
+static int tcp_send_max_len(struct tcp *conn)
+{
+	int mss = conn_mss(conn);
+
+#if defined(CONFIG_NET_TCP_GSO)
+	if (tcp_gso_allowed(conn)) {
+		return MIN(mss * CONFIG_NET_TCP_GSO_MAX_SEGS,
+			   UINT16_MAX - NET_IPV6H_LEN - NET_TCPH_LEN);
+	}
+#endif
+
+	return mss;
+}
+
+static struct net_pkt *tcp_send_data_alloc(struct tcp *conn, int *len)
+{
+	struct net_pkt *pkt;
+
+	if (IS_ENABLED(CONFIG_NET_TCP_GSO) && *len > conn_mss(conn)) {
+		/* The buffer is not limited to the interface MTU, as the
+		 * packet is split into segments before it is sent. If there
+		 * are not enough buffers right now, send just one segment.
+		 */
+		pkt = net_pkt_alloc_with_buffer(NULL, *len, AF_UNSPEC, 0,
+						K_NO_WAIT);
+		if (pkt) {
+			net_pkt_set_gso_size(pkt, conn_mss(conn));
+			return pkt;
+		}
+
+		*len = conn_mss(conn);
+	}
+
+	return tcp_pkt_alloc(conn, *len);
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
@@ -1177,14 +1261,14 @@ static int tcp_send_data(struct tcp *conn)
 
 	len = MIN3(conn->send_data_total - conn->unacked_len,
 		   conn->send_win - conn->unacked_len,
-		   conn_mss(conn));
+		   tcp_send_max_len(conn));
 	if (len == 0) {
 		NET_DBG("conn: %p no data to send", conn);
 		ret = -ENODATA;
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
+	pkt = tcp_send_data_alloc(conn, &len);
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
 		ret = -ENOBUFS;
@@ -0,0 +1,455 @@
+/** @file
+ * @brief TCP generic receive offload
+ *
+ * Consecutive in-order TCP segments of the same connection are merged into
+ * one network packet before they are passed to the IP input code.
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "tcp_internal.h"
+
+#define GRO_MAX_FLOWS CONFIG_NET_TCP_GRO_MAX_FLOWS
+
+enum gro_verdict {
+	GRO_PASS,	/* Not a TCP segment, merging does not affect it */
+	GRO_FLUSH_ALL,	/* Cannot tell the connection, pass up everything */
+	GRO_FLUSH,	/* TCP segment that cannot be merged */
+	GRO_MERGE,	/* TCP segment that can be merged */
+};
+
+struct gro_seg {
+	uint8_t *ip;
+	uint8_t *addr;
+	struct tcphdr *th;
+	uint16_t data_len;
+	uint8_t ip_len;
+	uint8_t addr_len;
+	sa_family_t family;
+};
+
+struct gro_flow {
+	/* Packet being built, NULL if the slot is free. The headers of the
+	 * first segment are kept, and only the payload of the following
+	 * segments is appended.
+	 */
+	struct net_pkt *pkt;
+	struct net_buf *tail;
+	struct gro_seg seg;
+	uint32_t next_seq;
+	/* Ones' complement sum of the collected payload */
+	uint16_t payload_sum;
+	uint16_t data_len;
+	uint8_t count;
+};
+
+struct gro_queue {
+	struct gro_flow flows[GRO_MAX_FLOWS];
+	uint8_t next_evict;
+};
+
+/* Each RX queue thread merges the segments it handles, so no locking
+ * is needed.
+ */
+static struct gro_queue gro_queues[NET_TC_RX_COUNT];
+
+static uint16_t chksum_add(uint16_t a, uint16_t b)
+{
+	uint32_t sum = (uint32_t)a + b;
+
+	return (sum & 0xffff) + (sum >> 16);
+}
+
+static uint16_t chksum_finalize(uint16_t sum)
+{
+	sum = (sum == 0U) ? 0xffff : htons(sum);
+
+	return ~sum;
+}
+
+static uint16_t pseudo_hdr_chksum(struct gro_seg *seg, uint16_t tcp_len)
+{
+	return calc_chksum(tcp_len + IPPROTO_TCP, seg->addr, seg->addr_len);
+}
+
+/* The checksum of a valid segment sums up to 0xffff, so the sum of the
+ * payload is known from the headers alone without reading the data.
+ * If the segment is corrupted, the checksum of the merged packet does
+ * not match its data and TCP drops it.
+ */
+static uint16_t payload_chksum(struct gro_seg *seg)
+{
+	uint16_t sum;
+
+	sum = pseudo_hdr_chksum(seg, seg->data_len + sizeof(struct tcphdr));
+	sum = calc_chksum(sum, (uint8_t *)seg->th, sizeof(struct tcphdr));
+
+	return ~sum;
+}
+
+static enum gro_verdict gro_parse(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	struct net_buf *buf = pkt->buffer;
+	uint16_t total_len;
+	uint8_t flags;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && (buf->data[0] & 0xf0) == 0x40) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)buf->data;
+
+		if (buf->len < sizeof(struct net_ipv4_hdr)) {
+			return GRO_FLUSH_ALL;
+		}
+
+		if (hdr->proto != IPPROTO_TCP) {
+			return GRO_PASS;
+		}
+
+		/* Fragments are merged later by the reassembly code */
+		if ((hdr->offset[0] & 0x3f) != 0U || hdr->offset[1] != 0U) {
+			return GRO_FLUSH_ALL;
+		}
+
+		seg->family = AF_INET;
+		seg->ip_len = (hdr->vhl & NET_IPV4_IHL_MASK) * 4U;
+		seg->addr = hdr->src;
+		seg->addr_len = 2 * NET_IPV4_ADDR_SIZE;
+		total_len = ntohs(hdr->len);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && (buf->data[0] & 0xf0) == 0x60) {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)buf->data;
+
+		if (buf->len < sizeof(struct net_ipv6_hdr)) {
+			return GRO_FLUSH_ALL;
+		}
+
+		if (hdr->nexthdr == IPPROTO_UDP || hdr->nexthdr == IPPROTO_ICMPV6) {
+			return GRO_PASS;
+		}
+
+		/* There might be a TCP segment behind the extension headers */
+		if (hdr->nexthdr != IPPROTO_TCP) {
+			return GRO_FLUSH_ALL;
+		}
+
+		seg->family = AF_INET6;
+		seg->ip_len = sizeof(struct net_ipv6_hdr);
+		seg->addr = hdr->src;
+		seg->addr_len = 2 * NET_IPV6_ADDR_SIZE;
+		total_len = ntohs(hdr->len) + sizeof(struct net_ipv6_hdr);
+	} else {
+		return GRO_PASS;
+	}
+
+	if (buf->len < seg->ip_len + sizeof(struct tcphdr)) {
+		return GRO_FLUSH_ALL;
+	}
+
+	seg->ip = buf->data;
+	seg->th = (struct tcphdr *)(buf->data + seg->ip_len);
+
+	/* Only plain data segments without IP or TCP options are merged */
+	flags = th_flags(seg->th);
+
+	if ((seg->family == AF_INET && seg->ip_len != sizeof(struct net_ipv4_hdr)) ||
+	    th_off(seg->th) != sizeof(struct tcphdr) / 4U ||
+	    (flags & ~PSH) != ACK) {
+		return GRO_FLUSH;
+	}
+
+	/* Link layer padding would end up in the middle of the data */
+	if (total_len <= seg->ip_len + sizeof(struct tcphdr) ||
+	    total_len != net_pkt_get_len(pkt)) {
+		return GRO_FLUSH;
+	}
+
+	if (seg->family == AF_INET &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt)) &&
+	    calc_chksum(0, seg->ip, seg->ip_len) != 0xffff) {
+		return GRO_FLUSH;
+	}
+
+	seg->data_len = total_len - seg->ip_len - sizeof(struct tcphdr);
+
+	return GRO_MERGE;
+}
+
+static bool gro_flow_match(struct gro_flow *flow, struct net_pkt *pkt,
+			   struct gro_seg *seg)
+{
+	return flow->pkt != NULL &&
+	       flow->seg.family == seg->family &&
+	       net_pkt_iface(flow->pkt) == net_pkt_iface(pkt) &&
+	       UNALIGNED_GET(&flow->seg.th->th_sport) ==
+					UNALIGNED_GET(&seg->th->th_sport) &&
+	       UNALIGNED_GET(&flow->seg.th->th_dport) ==
+					UNALIGNED_GET(&seg->th->th_dport) &&
+	       memcmp(flow->seg.addr, seg->addr, seg->addr_len) == 0;
+}
+
+static bool gro_flow_can_merge(struct gro_flow *flow, struct gro_seg *seg)
+{
+	if (th_seq(seg->th) != flow->next_seq ||
+	    UNALIGNED_GET(&seg->th->th_ack) != UNALIGNED_GET(&flow->seg.th->th_ack) ||
+	    UNALIGNED_GET(&seg->th->th_win) != UNALIGNED_GET(&flow->seg.th->th_win)) {
+		return false;
+	}
+
+	/* The payload sums can only be added if the data starts at an even
+	 * offset of the merged payload.
+	 */
+	if ((flow->data_len & 1U) != 0U ||
+	    flow->data_len + seg->data_len > CONFIG_NET_TCP_GRO_MAX_LEN) {
+		return false;
+	}
+
+	if (seg->family == AF_INET) {
+		struct net_ipv4_hdr *a = (struct net_ipv4_hdr *)flow->seg.ip;
+		struct net_ipv4_hdr *b = (struct net_ipv4_hdr *)seg->ip;
+
+		return a->tos == b->tos && a->ttl == b->ttl;
+	}
+
+	/* Traffic class, flow label and hop limit */
+	return memcmp(flow->seg.ip, seg->ip, 4) == 0 &&
+	       ((struct net_ipv6_hdr *)flow->seg.ip)->hop_limit ==
+				((struct net_ipv6_hdr *)seg->ip)->hop_limit;
+}
+
+static void gro_flow_start(struct gro_flow *flow, struct net_pkt *pkt,
+			   struct gro_seg *seg)
+{
+	flow->pkt = pkt;
+	flow->tail = net_buf_frag_last(pkt->buffer);
+	flow->seg = *seg;
+	flow->next_seq = th_seq(seg->th) + seg->data_len;
+	flow->payload_sum = payload_chksum(seg);
+	flow->data_len = seg->data_len;
+	flow->count = 1U;
+}
+
+static void gro_flow_merge(struct gro_flow *flow, struct net_pkt *pkt,
+			   struct gro_seg *seg)
+{
+	struct net_buf *buf = pkt->buffer;
+
+	flow->payload_sum = chksum_add(flow->payload_sum, payload_chksum(seg));
+	flow->data_len += seg->data_len;
+	flow->next_seq += seg->data_len;
+	flow->count++;
+
+	UNALIGNED_PUT(th_flags(flow->seg.th) | (th_flags(seg->th) & PSH),
+		      &flow->seg.th->th_flags);
+
+	/* Only the payload is kept, the data buffers are moved over to
+	 * the merged packet without copying.
+	 */
+	net_buf_pull(buf, seg->ip_len + sizeof(struct tcphdr));
+	if (buf->len == 0U) {
+		buf = net_buf_frag_del(NULL, buf);
+	}
+
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	net_buf_frag_insert(flow->tail, buf);
+	flow->tail = net_buf_frag_last(buf);
+}
+
+/* Rewrite the lengths and checksums of the merged packet headers */
+static void gro_flow_finalize(struct gro_flow *flow)
+{
+	struct gro_seg *seg = &flow->seg;
+	uint16_t tcp_len = flow->data_len + sizeof(struct tcphdr);
+	uint16_t sum;
+
+	if (seg->family == AF_INET) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)seg->ip;
+
+		hdr->len = htons(seg->ip_len + tcp_len);
+		hdr->chksum = 0U;
+		hdr->chksum = chksum_finalize(calc_chksum(0, seg->ip, seg->ip_len));
+	} else {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)seg->ip;
+
+		hdr->len = htons(tcp_len);
+	}
+
+	UNALIGNED_PUT(0, &seg->th->th_sum);
+
+	sum = pseudo_hdr_chksum(seg, tcp_len);
+	sum = calc_chksum(sum, (uint8_t *)seg->th, sizeof(struct tcphdr));
+	sum = chksum_add(sum, flow->payload_sum);
+
+	UNALIGNED_PUT(chksum_finalize(sum), &seg->th->th_sum);
+}
+
+static void gro_flow_flush(struct gro_flow *flow)
+{
+	struct net_pkt *pkt = flow->pkt;
+	enum net_verdict verdict;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	flow->pkt = NULL;
+
+	if (flow->count > 1U) {
+		NET_DBG("Merged %u segments, %u bytes (pkt %p)", flow->count,
+			flow->data_len, pkt);
+
+		gro_flow_finalize(flow);
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && flow->seg.family == AF_INET6) {
+		verdict = net_ipv6_input(pkt, false);
+	} else {
+		verdict = net_ipv4_input(pkt);
+	}
+
+	switch (verdict) {
+	case NET_OK:
+		break;
+	case NET_CONTINUE:
+		/* Tunneled packet, feed it back to the stack like
+		 * processing_data() does.
+		 */
+		if (IS_ENABLED(CONFIG_NET_L2_VIRTUAL) &&
+		    net_recv_data(net_pkt_iface(pkt), pkt) == 0) {
+			break;
+		}
+
+		__fallthrough;
+	case NET_DROP:
+	default:
+		net_pkt_unref(pkt);
+		break;
+	}
+}
+
+static void gro_queue_flush(struct gro_queue *queue)
+{
+	for (int i = 0; i < GRO_MAX_FLOWS; i++) {
+		gro_flow_flush(&queue->flows[i]);
+	}
+}
+
+static bool gro_is_local(struct gro_seg *seg)
+{
+	if (seg->family == AF_INET) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)seg->ip;
+
+		return net_ipv4_is_my_addr((struct in_addr *)hdr->dst);
+	}
+
+	return net_ipv6_is_my_addr((struct in6_addr *)
+				   ((struct net_ipv6_hdr *)seg->ip)->dst);
+}
+
+static struct gro_flow *gro_flow_alloc(struct gro_queue *queue)
+{
+	struct gro_flow *flow;
+
+	for (int i = 0; i < GRO_MAX_FLOWS; i++) {
+		if (queue->flows[i].pkt == NULL) {
+			return &queue->flows[i];
+		}
+	}
+
+	flow = &queue->flows[queue->next_evict];
+	queue->next_evict = (queue->next_evict + 1U) % GRO_MAX_FLOWS;
+
+	gro_flow_flush(flow);
+
+	return flow;
+}
+
+bool net_tcp_gro_receive(struct net_pkt *pkt)
+{
+	struct gro_flow *flow = NULL;
+	struct gro_queue *queue;
+	enum gro_verdict verdict;
+	struct gro_seg seg;
+	int tc;
+
+	/* Packets handled outside of the RX queue threads are not merged */
+	tc = net_tc_rx_current_queue();
+	if (tc < 0) {
+		return false;
+	}
+
+	queue = &gro_queues[tc];
+
+	verdict = gro_parse(pkt, &seg);
+	if (verdict == GRO_PASS) {
+		return false;
+	}
+
+	if (verdict == GRO_FLUSH_ALL) {
+		gro_queue_flush(queue);
+		return false;
+	}
+
+	for (int i = 0; i < GRO_MAX_FLOWS; i++) {
+		if (gro_flow_match(&queue->flows[i], pkt, &seg)) {
+			flow = &queue->flows[i];
+			break;
+		}
+	}
+
+	if (flow != NULL) {
+		if (verdict == GRO_MERGE && gro_flow_can_merge(flow, &seg)) {
+			gro_flow_merge(flow, pkt, &seg);
+
+			/* The sender wants the data to be delivered now */
+			if ((th_flags(flow->seg.th) & PSH) ||
+			    flow->data_len >= CONFIG_NET_TCP_GRO_MAX_LEN) {
+				gro_flow_flush(flow);
+			}
+
+			return true;
+		}
+
+		/* Keep the segments in order */
+		gro_flow_flush(flow);
+	}
+
+	if (verdict != GRO_MERGE || (th_flags(seg.th) & PSH) ||
+	    !gro_is_local(&seg)) {
+		return false;
+	}
+
+	if (flow == NULL) {
+		flow = gro_flow_alloc(queue);
+	}
+
+	gro_flow_start(flow, pkt, &seg);
+
+	return true;
+}
+
+void net_tcp_gro_flush(void)
+{
+	int tc = net_tc_rx_current_queue();
+
+	if (tc < 0) {
+		return;
+	}
+
+	gro_queue_flush(&gro_queues[tc]);
+}
@@ -0,0 +1,177 @@
+/** @file
+ * @brief TCP generic segmentation offload
+ *
+ * TCP data of several segments is passed through the IP layer as one
+ * network packet, and split into MSS sized segments just before it is
+ * given to the L2 driver.
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "ipv6.h"
+#include "tcp_internal.h"
+
+/* IP header with options or extension headers, and TCP header with options */
+#define GSO_HDR_MAX_LEN 128
+
+static void gso_copy_attributes(struct net_pkt *seg, struct net_pkt *pkt)
+{
+	net_pkt_set_family(seg, net_pkt_family(pkt));
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	net_pkt_set_vlan_tag(seg, net_pkt_vlan_tag(pkt));
+	net_pkt_set_ll_proto_type(seg, net_pkt_ll_proto_type(pkt));
+
+	memcpy(net_pkt_lladdr_src(seg), net_pkt_lladdr_src(pkt),
+	       sizeof(struct net_linkaddr));
+	memcpy(net_pkt_lladdr_dst(seg), net_pkt_lladdr_dst(pkt),
+	       sizeof(struct net_linkaddr));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   net_pkt_family(pkt) == AF_INET6) {
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+	}
+}
+
+static int gso_finalize(struct net_pkt *seg)
+{
+	net_pkt_cursor_init(seg);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+		return net_ipv4_finalize(seg, IPPROTO_TCP);
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(seg) == AF_INET6) {
+		return net_ipv6_finalize(seg, IPPROTO_TCP);
+	}
+
+	return -EINVAL;
+}
+
+/* Drop the data buffers already copied to segments, so that splitting
+ * a packet does not need twice the amount of buffers.
+ */
+static void gso_release_sent(struct net_pkt *pkt)
+{
+	while (pkt->buffer != NULL && pkt->buffer != pkt->cursor.buf) {
+		pkt->buffer = net_buf_frag_del(NULL, pkt->buffer);
+	}
+}
+
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	const struct net_l2 *l2 = net_if_l2(iface);
+	uint16_t mss = net_pkt_gso_size(pkt);
+	uint8_t hdr[GSO_HDR_MAX_LEN];
+	size_t ip_len, hdr_len, data_len;
+	size_t offset;
+	struct net_ipv4_hdr *ipv4_hdr = NULL;
+	struct tcphdr *th;
+	uint16_t ipv4_id = 0U;
+	uint32_t seq;
+	uint8_t flags;
+	int sent = 0;
+	int ret = 0;
+
+	ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	if (ip_len + sizeof(struct tcphdr) > sizeof(hdr)) {
+		return -EINVAL;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_read(pkt, hdr, ip_len + sizeof(struct tcphdr))) {
+		return -ENOBUFS;
+	}
+
+	th = (struct tcphdr *)(hdr + ip_len);
+	hdr_len = ip_len + th_off(th) * 4U;
+
+	if (hdr_len > sizeof(hdr) ||
+	    net_pkt_read(pkt, hdr + ip_len + sizeof(struct tcphdr),
+			 hdr_len - ip_len - sizeof(struct tcphdr))) {
+		return -EINVAL;
+	}
+
+	data_len = net_pkt_get_len(pkt) - hdr_len;
+	seq = th_seq(th);
+	flags = th_flags(th);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		ipv4_hdr = (struct net_ipv4_hdr *)hdr;
+		ipv4_id = sys_get_be16(ipv4_hdr->id);
+	}
+
+	NET_DBG("Splitting %zu bytes into %u byte segments (pkt %p)",
+		data_len, mss, pkt);
+
+	for (offset = 0; offset < data_len; offset += mss) {
+		size_t len = MIN(mss, data_len - offset);
+		struct net_pkt *seg;
+
+		seg = net_pkt_alloc_with_buffer(iface, hdr_len + len, AF_UNSPEC,
+						0, TCP_PKT_ALLOC_TIMEOUT);
+		if (!seg) {
+			ret = -ENOBUFS;
+			break;
+		}
+
+		gso_copy_attributes(seg, pkt);
+
+		/* Push and finish only apply to the end of the data */
+		UNALIGNED_PUT(htonl(seq + offset), &th->th_seq);
+		UNALIGNED_PUT(offset + len < data_len ? flags & ~(PSH | FIN) : flags,
+			      &th->th_flags);
+
+		/* Each segment is a datagram of its own */
+		if (ipv4_hdr != NULL) {
+			sys_put_be16(ipv4_id + offset / mss, ipv4_hdr->id);
+		}
+
+		if (net_pkt_write(seg, hdr, hdr_len) ||
+		    net_pkt_copy(seg, pkt, len) ||
+		    gso_finalize(seg) < 0) {
+			net_pkt_unref(seg);
+			ret = -ENOBUFS;
+			break;
+		}
+
+		gso_release_sent(pkt);
+
+		ret = l2->send(iface, seg);
+		if (ret < 0) {
+			net_pkt_unref(seg);
+			break;
+		}
+
+		sent += ret;
+	}
+
+	/* If some of the segments were sent, the rest is resent by TCP */
+	if (ret < 0 && offset == 0) {
+		return ret;
+	}
+
+	net_pkt_unref(pkt);
+
+	return sent;
+}
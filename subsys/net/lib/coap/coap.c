@@ -216,6 +216,52 @@ int coap_ack_init(struct coap_packet *cpkt, const struct coap_packet *req,
 				token, code, id);
 }
 
+#if defined(CONFIG_COAP_OPTION_INDEX)
+/* Packets with more options than the index can hold, or with options too
+ * large for struct coap_option, are not indexed. Lookups of such options
+ * must fail the same way as without the index, so leave them to the parser.
+ */
+#define OPTION_INDEX_INVALID UINT16_MAX
+
+static void option_index_add(struct coap_packet *cpkt, uint16_t *count,
+			     uint16_t code, uint16_t offset, uint16_t value_len)
+{
+	const struct coap_option *option = NULL;
+
+	if (*count >= ARRAY_SIZE(cpkt->opt_index) ||
+	    value_len > sizeof(option->value)) {
+		*count = OPTION_INDEX_INVALID;
+		return;
+	}
+
+	cpkt->opt_index[*count].code = code;
+	cpkt->opt_index[*count].offset = offset;
+	(*count)++;
+}
+
+static void option_index_set(struct coap_packet *cpkt, uint16_t count)
+{
+	cpkt->opt_index_len = count == OPTION_INDEX_INVALID ? 0U : count;
+}
+#else
+static inline void option_index_add(struct coap_packet *cpkt, uint16_t *count,
+				    uint16_t code, uint16_t offset,
+				    uint16_t value_len)
+{
+	ARG_UNUSED(cpkt);
+	ARG_UNUSED(count);
+	ARG_UNUSED(code);
+	ARG_UNUSED(offset);
+	ARG_UNUSED(value_len);
+}
+
+static inline void option_index_set(struct coap_packet *cpkt, uint16_t count)
+{
+	ARG_UNUSED(cpkt);
+	ARG_UNUSED(count);
+}
+#endif
+
 static void option_header_set_delta(uint8_t *opt, uint8_t delta)
 {
 	*opt = (delta & 0xF) << 4;
@@ -261,6 +307,9 @@ static int encode_option(struct coap_packet *cpkt, uint16_t code, const uint8_t
 	uint8_t len_size;
 	bool res;
 
+	/* Option positions change, the index is not valid anymore */
+	option_index_set(cpkt, 0U);
+
 	delta_size = encode_extended_option(code, &opt_delta, &delta_ext);
 	len_size = encode_extended_option(len, &opt_len, &len_ext);
 
@@ -503,7 +552,7 @@ static int decode_delta(uint8_t *data, uint16_t offset, uint16_t *pos, uint16_t
 
 static int parse_option(uint8_t *data, uint16_t offset, uint16_t *pos,
 			uint16_t max_len, uint16_t *opt_delta, uint16_t *opt_len,
-			struct coap_option *option)
+			struct coap_option *option, uint16_t *value_len)
 {
 	uint16_t hdr_len;
 	uint16_t delta;
@@ -574,6 +623,10 @@ static int parse_option(uint8_t *data, uint16_t offset, uint16_t *pos,
 		return -EINVAL;
 	}
 
+	if (value_len) {
+		*value_len = len;
+	}
+
 	if (option) {
 		/*
 		 * Make sure the option data will fit into the value field of
@@ -608,6 +661,7 @@ static int parse_option(uint8_t *data, uint16_t offset, uint16_t *pos,
 int coap_packet_parse(struct coap_packet *cpkt, uint8_t *data, uint16_t len,
 		      struct coap_option *options, uint8_t opt_num)
 {
+	uint16_t indexed = 0U;
 	uint16_t opt_len;
 	uint16_t offset;
 	uint16_t delta;
@@ -633,6 +687,7 @@ int coap_packet_parse(struct coap_packet *cpkt, uint8_t *data, uint16_t len,
 	cpkt->opt_len = 0U;
 	cpkt->hdr_len = 0U;
 	cpkt->delta = 0U;
+	option_index_set(cpkt, 0U);
 
 	/* Token lengths 9-15 are reserved. */
 	tkl = cpkt->data[0] & 0x0f;
@@ -656,13 +711,24 @@ int coap_packet_parse(struct coap_packet *cpkt, uint8_t *data, uint16_t len,
 
 	while (1) {
 		struct coap_option *option;
+		uint16_t start = offset;
+		uint16_t prev_opt_len = opt_len;
+		uint16_t value_len = 0U;
 
 		option = num < opt_num ? &options[num++] : NULL;
 		ret = parse_option(cpkt->data, offset, &offset, cpkt->max_len,
-				   &delta, &opt_len, option);
+				   &delta, &opt_len, option, &value_len);
 		if (ret < 0) {
 			return -EILSEQ;
-		} else if (ret == 0) {
+		}
+
+		/* Nothing was consumed when the payload marker was reached */
+		if (opt_len != prev_opt_len) {
+			option_index_add(cpkt, &indexed, delta, start,
+					 value_len);
+		}
+
+		if (ret == 0) {
 			break;
 		}
 	}
@@ -670,9 +736,46 @@ int coap_packet_parse(struct coap_packet *cpkt, uint8_t *data, uint16_t len,
 	cpkt->opt_len = opt_len;
 	cpkt->delta = delta;
 
+	option_index_set(cpkt, indexed);
+
 	return 0;
 }
 
+#if defined(CONFIG_COAP_OPTION_INDEX)
+static int find_indexed_options(const struct coap_packet *cpkt, uint16_t code,
+				struct coap_option *options, uint16_t veclen)
+{
+	uint16_t opt_len = 0U;
+	uint16_t offset;
+	uint16_t delta;
+	uint8_t num = 0U;
+	uint8_t i;
+
+	/* Options are indexed in ascending order of their number */
+	for (i = 0U; i < cpkt->opt_index_len && num < veclen; i++) {
+		if (cpkt->opt_index[i].code < code) {
+			continue;
+		}
+
+		if (cpkt->opt_index[i].code > code) {
+			break;
+		}
+
+		offset = cpkt->opt_index[i].offset;
+		delta = i > 0U ? cpkt->opt_index[i - 1].code : 0U;
+
+		if (parse_option(cpkt->data, offset, &offset, cpkt->max_len,
+				 &delta, &opt_len, &options[num], NULL) < 0) {
+			return -EINVAL;
+		}
+
+		num++;
+	}
+
+	return num;
+}
+#endif
+
 int coap_find_options(const struct coap_packet *cpkt, uint16_t code,
 		      struct coap_option *options, uint16_t veclen)
 {
@@ -687,6 +790,12 @@ int coap_find_options(const struct coap_packet *cpkt, uint16_t code,
 		return 0;
 	}
 
+#if defined(CONFIG_COAP_OPTION_INDEX)
+	if (cpkt->opt_index_len) {
+		return find_indexed_options(cpkt, code, options, veclen);
+	}
+#endif
+
 	offset = cpkt->hdr_len;
 	opt_len = 0U;
 	delta = 0U;
@@ -695,7 +804,7 @@ int coap_find_options(const struct coap_packet *cpkt, uint16_t code,
 	while (delta <= code && num < veclen) {
 		r = parse_option(cpkt->data, offset, &offset,
 				 cpkt->max_len, &delta, &opt_len,
-				 &options[num]);
+				 &options[num], NULL);
 		if (r < 0) {
 			return -EINVAL;
 		}
@@ -926,6 +1035,25 @@ static bool is_request(const struct coap_packet *cpkt)
 	return !(code & ~COAP_REQUEST_MASK);
 }
 
+static int call_method(struct coap_resource *resource,
+		       struct coap_packet *cpkt,
+		       struct sockaddr *addr, socklen_t addr_len)
+{
+	coap_method_t method;
+	uint8_t code;
+
+	code = coap_header_get_code(cpkt);
+	if (method_from_code(resource, code, &method) < 0) {
+		return -ENOTSUP;
+	}
+
+	if (!method) {
+		return -EPERM;
+	}
+
+	return method(resource, cpkt, addr, addr_len);
+}
+
 int coap_handle_request(struct coap_packet *cpkt,
 			struct coap_resource *resources,
 			struct coap_option *options,
@@ -938,29 +1066,313 @@ int coap_handle_request(struct coap_packet *cpkt,
 		return 0;
 	}
 
-	/* FIXME: deal with hierarchical resources */
+	/* See coap_router_handle_request() for hierarchical resources */
 	for (resource = resources; resource && resource->path; resource++) {
-		coap_method_t method;
-		uint8_t code;
-
 		if (!uri_path_eq(cpkt, resource->path, options, opt_num)) {
 			continue;
 		}
 
-		code = coap_header_get_code(cpkt);
-		if (method_from_code(resource, code, &method) < 0) {
-			return -ENOTSUP;
+		return call_method(resource, cpkt, addr, addr_len);
+	}
+
+	NET_DBG("%d", __LINE__);
+	return -ENOENT;
+}
+
+static bool is_wildcard(const char *segment, char wildcard)
+{
+	return IS_ENABLED(CONFIG_COAP_URI_WILDCARD) &&
+	       segment[0] == wildcard && segment[1] == '\0';
+}
+
+static uint32_t router_hash(const struct coap_router_node *parent,
+			   const uint8_t *segment, uint16_t len)
+{
+	/* FNV-1a, seeded with the parent node */
+	uint32_t hash = 2166136261U ^ (uint32_t)(uintptr_t)parent;
+	uint16_t i;
+
+	for (i = 0U; i < len; i++) {
+		hash ^= segment[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static struct coap_router_node *router_find(const struct coap_router *router,
+					    const struct coap_router_node *parent,
+					    const uint8_t *segment, uint16_t len)
+{
+	struct coap_router_node *node;
+
+	if (router->nodes_used == 0U) {
+		return NULL;
+	}
+
+	/* The node array doubles as the hash table of the child nodes */
+	node = router->nodes[router_hash(parent, segment, len) %
+			     router->nodes_count].bucket;
+
+	for (; node; node = node->hash_next) {
+		if (node->parent == parent && node->segment_len == len &&
+		    !memcmp(node->segment, segment, len)) {
+			return node;
+		}
+	}
+
+	return NULL;
+}
+
+static struct coap_router_node *router_add(struct coap_router *router,
+					   struct coap_router_node *parent,
+					   const char *segment)
+{
+	uint16_t len = strlen(segment);
+	struct coap_router_node *node;
+	struct coap_router_node **bucket;
+
+	if (is_wildcard(segment, '+')) {
+		node = parent->any_segment;
+	} else {
+		node = router_find(router, parent, segment, len);
+	}
+
+	if (node) {
+		return node;
+	}
+
+	if (router->nodes_used == router->nodes_count) {
+		return NULL;
+	}
+
+	node = &router->nodes[router->nodes_used++];
+	node->parent = parent;
+	node->segment = segment;
+	node->segment_len = len;
+
+	if (is_wildcard(segment, '+')) {
+		parent->any_segment = node;
+	} else {
+		bucket = &router->nodes[router_hash(parent, segment, len) %
+					router->nodes_count].bucket;
+		node->hash_next = *bucket;
+		*bucket = node;
+	}
+
+	return node;
+}
+
+static inline bool router_is_any_segment(const struct coap_router_node *node)
+{
+	return node->parent && node->parent->any_segment == node;
+}
+
+static size_t router_depth(const struct coap_router_node *node)
+{
+	size_t depth = 0U;
+
+	for (; node->parent; node = node->parent) {
+		depth++;
+	}
+
+	return depth;
+}
+
+/* Whether both paths have the same depth and "+" at the same levels */
+static bool router_same_pattern(const struct coap_router_node *node1,
+				const struct coap_router_node *node2)
+{
+	while (node1 && node2) {
+		if (router_is_any_segment(node1) != router_is_any_segment(node2)) {
+			return false;
+		}
+
+		node1 = node1->parent;
+		node2 = node2->parent;
+	}
+
+	return node1 == node2;
+}
+
+/* A request path matches at most one node of each "+" pattern, so the
+ * number of distinct patterns of a depth bounds the partial matches a
+ * lookup has to follow at once.
+ */
+static size_t router_max_matches(const struct coap_router *router)
+{
+	size_t max_matches = 1U;
+	size_t depth, matches;
+	size_t i, j;
+	bool found;
+
+	for (depth = 1U, found = true; found; depth++) {
+		found = false;
+		matches = 0U;
+
+		for (i = 0U; i < router->nodes_used; i++) {
+			if (router_depth(&router->nodes[i]) != depth) {
+				continue;
+			}
+
+			found = true;
+
+			for (j = 0U; j < i; j++) {
+				if (router_same_pattern(&router->nodes[i],
+							&router->nodes[j])) {
+					break;
+				}
+			}
+
+			if (j == i) {
+				matches++;
+			}
+		}
+
+		max_matches = MAX(max_matches, matches);
+	}
+
+	return max_matches;
+}
+
+int coap_router_init(struct coap_router *router,
+		     struct coap_resource *resources,
+		     struct coap_router_node *nodes,
+		     size_t nodes_count)
+{
+	struct coap_resource *resource;
+	struct coap_router_node *node;
+	const char * const *path;
+
+	memset(router, 0, sizeof(*router));
+	memset(nodes, 0, sizeof(*nodes) * nodes_count);
+
+	router->nodes = nodes;
+	router->nodes_count = nodes_count;
+
+	for (resource = resources; resource && resource->path; resource++) {
+		node = &router->root;
+
+		for (path = resource->path; *path; path++) {
+			/* Multi-level wildcard ends the path */
+			if (is_wildcard(*path, '#')) {
+				break;
+			}
+
+			node = router_add(router, node, *path);
+			if (!node) {
+				return -ENOMEM;
+			}
+		}
+
+		/* Keep the first matching resource, like the linear search */
+		if (*path) {
+			if (!node->any_path) {
+				node->any_path = resource;
+			}
+		} else if (!node->resource) {
+			node->resource = resource;
 		}
+	}
+
+	if (router_max_matches(router) > CONFIG_COAP_ROUTER_MAX_MATCHES) {
+		NET_DBG("Router %p has too many overlapping wildcard paths",
+			router);
+		return -E2BIG;
+	}
+
+	NET_DBG("Router %p uses %zu nodes", router, router->nodes_used);
+
+	return 0;
+}
 
-		if (!method) {
-			return -EPERM;
+static inline void router_match_update(struct coap_resource **found,
+				       struct coap_resource *resource)
+{
+	if (resource && (!*found || resource < *found)) {
+		*found = resource;
+	}
+}
+
+struct coap_resource *coap_router_lookup(const struct coap_router *router,
+					 const struct coap_option *options,
+					 uint8_t opt_num)
+{
+	const struct coap_router_node *matches[2][CONFIG_COAP_ROUTER_MAX_MATCHES];
+	const struct coap_router_node **cur = matches[0];
+	const struct coap_router_node **next = matches[1];
+	const struct coap_router_node **tmp;
+	const struct coap_router_node *child;
+	struct coap_resource *found = NULL;
+	size_t cur_count = 1U;
+	size_t next_count;
+	size_t j;
+	uint8_t i = 0U;
+
+	/* Follow all partial matches level by level, so that each node is
+	 * looked at once at most, however wildcards and literals overlap.
+	 */
+	cur[0] = &router->root;
+
+	while (cur_count > 0U) {
+		while (i < opt_num && options[i].delta != COAP_OPTION_URI_PATH) {
+			i++;
 		}
 
-		return method(resource, cpkt, addr, addr_len);
+		if (i == opt_num) {
+			for (j = 0U; j < cur_count; j++) {
+				router_match_update(&found, cur[j]->resource);
+			}
+
+			break;
+		}
+
+		next_count = 0U;
+
+		for (j = 0U; j < cur_count; j++) {
+			/* Multi-level wildcard needs at least one more segment */
+			router_match_update(&found, cur[j]->any_path);
+
+			child = router_find(router, cur[j], options[i].value,
+					    options[i].len);
+			if (child && next_count < CONFIG_COAP_ROUTER_MAX_MATCHES) {
+				next[next_count++] = child;
+			}
+
+			child = cur[j]->any_segment;
+			if (child && next_count < CONFIG_COAP_ROUTER_MAX_MATCHES) {
+				next[next_count++] = child;
+			}
+		}
+
+		tmp = cur;
+		cur = next;
+		next = tmp;
+		cur_count = next_count;
+		i++;
 	}
 
-	NET_DBG("%d", __LINE__);
-	return -ENOENT;
+	return found;
+}
+
+int coap_router_handle_request(const struct coap_router *router,
+			       struct coap_packet *cpkt,
+			       struct coap_option *options,
+			       uint8_t opt_num,
+			       struct sockaddr *addr, socklen_t addr_len)
+{
+	struct coap_resource *resource;
+
+	if (!is_request(cpkt)) {
+		return 0;
+	}
+
+	resource = coap_router_lookup(router, options, opt_num);
+	if (!resource) {
+		return -ENOENT;
+	}
+
+	return call_method(resource, cpkt, addr, addr_len);
 }
 
 int coap_block_transfer_init(struct coap_block_context *ctx,
@@ -1086,7 +1498,7 @@ int insert_option(struct coap_packet *cpkt, uint16_t code, const uint8_t *value,
 
 	while (offset < cpkt->hdr_len + cpkt->opt_len) {
 		r = parse_option(cpkt->data, offset, &offset, cpkt->hdr_len + cpkt->opt_len,
-				 &opt_delta, &opt_len, &option);
+				 &opt_delta, &opt_len, &option, NULL);
 		if (r < 0) {
 			return -EILSEQ;
 		}
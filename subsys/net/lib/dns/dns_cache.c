@@ -0,0 +1,207 @@
+/** @file
+ * @brief DNS answer cache
+ *
+ * Remember the answers received from the DNS servers for as long as
+ * their time to live allows.
+ */
+
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
+
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/dns_resolve.h>
+#include "dns_internal.h"
+
+#define CACHE_ADDR_COUNT CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES
+
+struct dns_cache_entry {
+	/* Uptime in ms when the answer expires, 0 if the entry is free */
+	int64_t expires;
+	/* Value of the use counter when the entry was last used */
+	uint32_t last_used;
+	/* Context whose DNS servers gave the answer */
+	const struct dns_resolve_context *ctx;
+	struct sockaddr addr[CACHE_ADDR_COUNT];
+	uint8_t count;
+	enum dns_query_type type;
+	char query[CONFIG_DNS_RESOLVER_CACHE_MAX_NAME_LEN + 1];
+};
+
+static struct dns_cache_entry cache[CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES];
+static struct dns_cache_stats cache_stats;
+static uint32_t use_counter;
+
+static K_MUTEX_DEFINE(cache_lock);
+
+/* Must be invoked with cache lock held */
+static bool entry_valid(struct dns_cache_entry *entry, int64_t now)
+{
+	if (entry->expires == 0) {
+		return false;
+	}
+
+	if (entry->expires <= now) {
+		entry->expires = 0;
+		return false;
+	}
+
+	return true;
+}
+
+/* Must be invoked with cache lock held */
+static struct dns_cache_entry *entry_find(const struct dns_resolve_context *ctx,
+					  const char *query,
+					  enum dns_query_type type,
+					  int64_t now)
+{
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (entry_valid(&cache[i], now) && cache[i].ctx == ctx &&
+		    cache[i].type == type &&
+		    strcmp(cache[i].query, query) == 0) {
+			return &cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Must be invoked with cache lock held. Returns a free or expired entry,
+ * or the least recently used one if the cache is full.
+ */
+static struct dns_cache_entry *entry_alloc(int64_t now)
+{
+	struct dns_cache_entry *lru = &cache[0];
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (!entry_valid(&cache[i], now)) {
+			return &cache[i];
+		}
+
+		if (use_counter - cache[i].last_used >
+		    use_counter - lru->last_used) {
+			lru = &cache[i];
+		}
+	}
+
+	NET_DBG("Dropping %s from the cache", lru->query);
+
+	return lru;
+}
+
+void dns_cache_add(const struct dns_resolve_context *ctx,
+		   const char *query, enum dns_query_type type,
+		   const struct sockaddr *addr, int count, uint32_t ttl)
+{
+	struct dns_cache_entry *entry;
+	int64_t now;
+
+	if (ttl == 0 || strlen(query) > CONFIG_DNS_RESOLVER_CACHE_MAX_NAME_LEN) {
+		return;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	now = k_uptime_get();
+
+	entry = entry_find(ctx, query, type, now);
+	if (entry == NULL) {
+		entry = entry_alloc(now);
+		entry->ctx = ctx;
+		strcpy(entry->query, query);
+		entry->type = type;
+	}
+
+	entry->count = MIN(count, CACHE_ADDR_COUNT);
+	if (entry->count > 0) {
+		memcpy(entry->addr, addr,
+		       entry->count * sizeof(struct sockaddr));
+	}
+
+	entry->expires = now + (int64_t)ttl * MSEC_PER_SEC;
+	entry->last_used = use_counter++;
+
+	NET_DBG("Cached %d address(es) for %s type %d for %u s", entry->count,
+		query, type, ttl);
+
+	k_mutex_unlock(&cache_lock);
+}
+
+int dns_cache_find(const struct dns_resolve_context *ctx,
+		   const char *query, enum dns_query_type type,
+		   struct sockaddr *addr, int max_count)
+{
+	struct dns_cache_entry *entry;
+	int ret = -ENOENT;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	entry = entry_find(ctx, query, type, k_uptime_get());
+	if (entry == NULL) {
+		cache_stats.misses++;
+		goto unlock;
+	}
+
+	cache_stats.hits++;
+	entry->last_used = use_counter++;
+
+	ret = MIN(entry->count, max_count);
+	memcpy(addr, entry->addr, ret * sizeof(struct sockaddr));
+
+unlock:
+	k_mutex_unlock(&cache_lock);
+
+	return ret;
+}
+
+void dns_cache_flush(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		cache[i].expires = 0;
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void dns_cache_flush_ctx(const struct dns_resolve_context *ctx)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (cache[i].ctx == ctx) {
+			cache[i].expires = 0;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void dns_cache_get_stats(struct dns_cache_stats *stats)
+{
+	int64_t now;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	now = k_uptime_get();
+
+	*stats = cache_stats;
+	stats->entries = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (entry_valid(&cache[i], now)) {
+			stats->entries++;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
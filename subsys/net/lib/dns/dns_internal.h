@@ -18,3 +18,21 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		     struct net_buf *dns_cname,
 		     uint16_t *query_hash);
 #endif
+
+/* Store the answer given by the DNS servers of a context to a query in the
+ * cache. A count of 0 stores a negative answer. The ttl is given in seconds.
+ */
+void dns_cache_add(const struct dns_resolve_context *ctx,
+		   const char *query, enum dns_query_type type,
+		   const struct sockaddr *addr, int count, uint32_t ttl);
+
+/* Look up the answer to a query of a context from the cache. Returns the
+ * number of addresses copied to addr, which is 0 for a negative answer, or
+ * -ENOENT if there is no valid answer in the cache.
+ */
+int dns_cache_find(const struct dns_resolve_context *ctx,
+		   const char *query, enum dns_query_type type,
+		   struct sockaddr *addr, int max_count);
+
+/* Remove the answers given by the DNS servers of a context */
+void dns_cache_flush_ctx(const struct dns_resolve_context *ctx);
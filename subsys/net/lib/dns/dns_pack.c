@@ -177,6 +177,78 @@ int dns_unpack_answer(struct dns_msg_t *dns_msg, int dname_ptr, uint32_t *ttl,
 	return 0;
 }
 
+int dns_unpack_soa_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl)
+{
+	uint16_t offset = dns_msg->answer_offset;
+	uint16_t rdlength;
+	uint32_t minimum;
+	uint8_t *record;
+	int dname_len;
+	int name_len;
+	int len;
+	int i;
+
+	for (i = 0; i < dns_header_nscount(dns_msg->msg); i++) {
+		record = dns_msg->msg + offset;
+
+		dname_len = skip_fqdn(record, dns_msg->msg_size - offset);
+		if (dname_len < 0) {
+			return dname_len;
+		}
+
+		/* type + class + ttl + rdlength, see RFC-1035 4.1.3 */
+		if (dns_msg->msg_size - offset - dname_len <
+		    2 + 2 + DNS_TTL_LEN + DNS_RDLENGTH_LEN) {
+			return -EINVAL;
+		}
+
+		rdlength = dns_answer_rdlength(dname_len, record);
+		offset += dname_len + 2 + 2 + DNS_TTL_LEN + DNS_RDLENGTH_LEN;
+
+		if (dns_msg->msg_size - offset < rdlength) {
+			return -EINVAL;
+		}
+
+		if (dns_answer_type(dname_len, record) != DNS_RR_TYPE_SOA ||
+		    dns_answer_class(dname_len, record) != DNS_CLASS_IN) {
+			offset += rdlength;
+			continue;
+		}
+
+		/* MNAME and RNAME are followed by SERIAL, REFRESH, RETRY,
+		 * EXPIRE and MINIMUM, see RFC-1035 3.3.13.
+		 */
+		name_len = skip_fqdn(dns_msg->msg + offset, rdlength);
+		if (name_len < 0) {
+			return name_len;
+		}
+
+		len = skip_fqdn(dns_msg->msg + offset + name_len,
+				rdlength - name_len);
+		if (len < 0) {
+			return len;
+		}
+
+		name_len += len;
+		if (rdlength - name_len < 5 * DNS_TTL_LEN) {
+			return -EINVAL;
+		}
+
+		minimum = ntohl(UNALIGNED_GET((uint32_t *)(dns_msg->msg + offset +
+							   name_len +
+							   4 * DNS_TTL_LEN)));
+
+		/* A negative answer is kept for the lesser of the SOA TTL
+		 * and MINIMUM, see RFC-2308 5.
+		 */
+		*ttl = MIN((uint32_t)dns_answer_ttl(dname_len, record), minimum);
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
 int dns_unpack_response_header(struct dns_msg_t *msg, int src_id)
 {
 	uint8_t *dns_header;
@@ -89,6 +89,7 @@ enum dns_rr_type {
 	DNS_RR_TYPE_INVALID = 0,
 	DNS_RR_TYPE_A	= 1,		/* IPv4  */
 	DNS_RR_TYPE_CNAME = 5,		/* CNAME */
+	DNS_RR_TYPE_SOA = 6,		/* SOA   */
 	DNS_RR_TYPE_PTR = 12,		/* PTR   */
 	DNS_RR_TYPE_TXT = 16,		/* TXT   */
 	DNS_RR_TYPE_AAAA = 28,		/* IPv6  */
@@ -347,6 +348,18 @@ int dns_msg_pack_qname(uint16_t *len, uint8_t *buf, uint16_t size,
 int dns_unpack_answer(struct dns_msg_t *dns_msg, int dname_ptr, uint32_t *ttl,
 		      enum dns_rr_type *type);
 
+/**
+ * @brief Finds the time to live of a negative answer
+ *
+ * @param dns_msg Structure, the answer_offset must point to the authority
+ *        section.
+ * @param ttl The lesser of the TTL and MINIMUM fields of the SOA record.
+ * @retval 0 on success
+ * @retval -ENOENT if the authority section has no SOA record
+ * @retval -EINVAL if the authority section is malformed
+ */
+int dns_unpack_soa_ttl(struct dns_msg_t *dns_msg, uint32_t *ttl);
+
 /**
  * @brief Unpacks the header's response.
  *
@@ -460,6 +460,123 @@ static inline int get_slot_by_id(struct dns_resolve_context *ctx,
 	return -ENOENT;
 }
 
+/* The queries for the same name and type are coalesced so that only the
+ * first one is sent to the DNS server, and the answer is given to all of
+ * them. The other ones are linked to the first one by their primary index.
+ */
+
+/* Check if a query slot is pending and waits for the answer to the
+ * question sent by another one.
+ *
+ * Must be invoked with context lock held.
+ */
+static inline bool is_coalesced(struct dns_resolve_context *ctx, int i,
+				int primary)
+{
+	return ctx->queries[i].primary == primary &&
+		ctx->queries[i].cb != NULL && ctx->queries[i].query != NULL;
+}
+
+/* Find a pending query which sent the same question as a query slot.
+ * Released queries and queries coalesced with another one are skipped.
+ *
+ * Must be invoked with context lock held.
+ */
+static int get_slot_by_query(struct dns_resolve_context *ctx, int query_idx)
+{
+	struct dns_pending_query *query = &ctx->queries[query_idx];
+	int i;
+
+	for (i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		struct dns_pending_query *pending = &ctx->queries[i];
+
+		if (i != query_idx && pending->primary < 0 &&
+		    pending->cb != NULL && pending->query != NULL &&
+		    pending->query_type == query->query_type &&
+		    strcmp(pending->query, query->query) == 0) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
+/* Invoke the callback of a query slot, and of the slots that were
+ * coalesced with it.
+ *
+ * Must be invoked with context lock held.
+ */
+static void invoke_query_callbacks(struct dns_resolve_context *ctx,
+				   int status,
+				   struct dns_addrinfo *info,
+				   int query_idx)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		if (i == query_idx || is_coalesced(ctx, i, query_idx)) {
+			invoke_query_callback(status, info, &ctx->queries[i]);
+		}
+	}
+}
+
+/* Release a query slot, and the slots that were coalesced with it.
+ *
+ * Must be invoked with context lock held.
+ */
+static void release_queries(struct dns_resolve_context *ctx, int query_idx)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		if (is_coalesced(ctx, i, query_idx)) {
+			release_query(&ctx->queries[i]);
+			ctx->queries[i].primary = -1;
+		}
+	}
+
+	release_query(&ctx->queries[query_idx]);
+}
+
+/* Check if a name is resolved with mDNS */
+static bool is_mdns_query(const char *query)
+{
+	const char *ptr;
+
+	if (!IS_ENABLED(CONFIG_MDNS_RESOLVER)) {
+		return false;
+	}
+
+	ptr = strrchr(query, '.');
+
+	/* Note that we memcmp() the \0 here too */
+	return ptr && !memcmp(ptr, (const void *){ ".local" }, 7);
+}
+
+/* Answers to mDNS and LLMNR queries come from the hosts of the local link,
+ * which can come and go at any time, so they are not cached. If LLMNR is
+ * enabled, all the queries that are not mDNS queries use it.
+ */
+static bool is_cacheable_query(const char *query)
+{
+	return IS_ENABLED(CONFIG_DNS_RESOLVER_CACHE) &&
+		!IS_ENABLED(CONFIG_LLMNR_RESOLVER) && !is_mdns_query(query);
+}
+
+/* Check if a response tells that the name exists but has no record of the
+ * queried type (NODATA, see RFC 2308). It has no error and no answer, which
+ * dns_unpack_response_header() rejects.
+ */
+static bool is_nodata_response(struct dns_msg_t *dns_msg)
+{
+	return dns_msg->msg_size >= DNS_MSG_HEADER_SIZE &&
+		dns_header_qr(dns_msg->msg) == DNS_RESPONSE &&
+		dns_header_opcode(dns_msg->msg) == DNS_QUERY &&
+		dns_header_rcode(dns_msg->msg) == DNS_HEADER_NOERROR &&
+		dns_header_qdcount(dns_msg->msg) == 1 &&
+		dns_header_ancount(dns_msg->msg) == 0;
+}
+
 /* Unit test needs to be able to call this function */
 #if !defined(CONFIG_NET_TEST)
 static
@@ -472,7 +589,11 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		     uint16_t *query_hash)
 {
 	struct dns_addrinfo info = { 0 };
-	uint32_t ttl; /* RR ttl, so far it is not passed to caller */
+	uint32_t ttl; /* RR ttl, only used for caching */
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	struct sockaddr cache_addr[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES];
+	uint32_t cache_ttl = UINT32_MAX;
+#endif
 	uint8_t *src, *addr;
 	const char *query_name;
 	int address_size;
@@ -510,7 +631,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 	}
 
 	ret = dns_unpack_response_header(dns_msg, *dns_id);
-	if (ret < 0) {
+	if (ret < 0 && !is_nodata_response(dns_msg)) {
 		ret = DNS_EAI_FAIL;
 		goto quit;
 	}
@@ -633,8 +754,17 @@ query_known:
 			src = dns_msg->msg + dns_msg->response_position;
 			memcpy(addr, src, address_size);
 
-			invoke_query_callback(DNS_EAI_INPROGRESS, &info,
-					      &ctx->queries[*query_idx]);
+			invoke_query_callbacks(ctx, DNS_EAI_INPROGRESS, &info,
+					       *query_idx);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+			if (items < ARRAY_SIZE(cache_addr)) {
+				memcpy(&cache_addr[items], &info.ai_addr,
+				       sizeof(info.ai_addr));
+			}
+
+			cache_ttl = MIN(cache_ttl, ttl);
+#endif
 			items++;
 			break;
 
@@ -676,7 +806,7 @@ query_known:
 	/* No IP addresses were found, so we take the last CNAME to generate
 	 * another query. Number of additional queries is controlled via Kconfig
 	 */
-	if (items == 0) {
+	if (items == 0 && server_idx > 0) {
 		if (dns_msg->response_type == DNS_RESPONSE_CNAME_NO_IP) {
 			uint16_t pos = dns_msg->response_position;
 
@@ -706,6 +836,27 @@ query_known:
 		ret = DNS_EAI_ALLDONE;
 	}
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	/* The answers are cached under the name that was queried, even if
+	 * they were found through a CNAME.
+	 */
+	if (ctx->queries[*query_idx].query != NULL &&
+	    is_cacheable_query(ctx->queries[*query_idx].query)) {
+		/* Without answers the offset points to the authority section,
+		 * whose SOA record tells how long the NODATA answer is valid.
+		 */
+		if (items == 0 &&
+		    (CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL == 0 ||
+		     dns_unpack_soa_ttl(dns_msg, &cache_ttl) < 0)) {
+			cache_ttl = CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL;
+		}
+
+		dns_cache_add(ctx, ctx->queries[*query_idx].query,
+			      ctx->queries[*query_idx].query_type,
+			      cache_addr, items, cache_ttl);
+	}
+#endif
+
 quit:
 	return ret;
 }
@@ -748,10 +899,10 @@ static int dns_read(struct dns_resolve_context *ctx,
 		goto quit;
 	}
 
-	invoke_query_callback(ret, NULL, &ctx->queries[query_idx]);
+	invoke_query_callbacks(ctx, ret, NULL, query_idx);
 
 	/* Marks the end of the results */
-	release_query(&ctx->queries[query_idx]);
+	release_queries(ctx, query_idx);
 
 	net_pkt_unref(pkt);
 
@@ -853,10 +1004,10 @@ quit:
 		goto free_buf;
 	}
 
-	invoke_query_callback(ret, NULL, &ctx->queries[i]);
+	invoke_query_callbacks(ctx, ret, NULL, i);
 
 	/* Marks the end of the results */
-	release_query(&ctx->queries[i]);
+	release_queries(ctx, i);
 
 free_buf:
 	if (dns_data) {
@@ -948,6 +1099,136 @@ static int dns_write(struct dns_resolve_context *ctx,
 	return 0;
 }
 
+/* Send the question of a query slot to the DNS servers.
+ *
+ * Must be invoked with context lock held.
+ */
+static int dns_send_query(struct dns_resolve_context *ctx, int query_idx)
+{
+	struct net_buf *dns_data = NULL;
+	struct net_buf *dns_qname = NULL;
+	bool mdns_query = is_mdns_query(ctx->queries[query_idx].query);
+	uint8_t hop_limit;
+	int failure = 0;
+	int ret, j;
+
+	dns_data = net_buf_alloc(&dns_msg_pool, ctx->buf_timeout);
+	if (!dns_data) {
+		ret = -ENOMEM;
+		goto quit;
+	}
+
+	dns_qname = net_buf_alloc(&dns_qname_pool, ctx->buf_timeout);
+	if (!dns_qname) {
+		ret = -ENOMEM;
+		goto quit;
+	}
+
+	ret = dns_msg_pack_qname(&dns_qname->len, dns_qname->data,
+				DNS_MAX_NAME_LEN, ctx->queries[query_idx].query);
+	if (ret < 0) {
+		goto quit;
+	}
+
+	for (j = 0; j < SERVER_COUNT; j++) {
+		hop_limit = 0U;
+
+		if (!ctx->servers[j].net_ctx) {
+			continue;
+		}
+
+		/* If mDNS is enabled, then send .local queries only to
+		 * a well known multicast mDNS server address.
+		 */
+		if (IS_ENABLED(CONFIG_MDNS_RESOLVER) && mdns_query &&
+		    !ctx->servers[j].is_mdns) {
+			continue;
+		}
+
+		/* If llmnr is enabled, then all the queries are sent to
+		 * LLMNR multicast address unless it is a mDNS query.
+		 */
+		if (!mdns_query && IS_ENABLED(CONFIG_LLMNR_RESOLVER)) {
+			if (!ctx->servers[j].is_llmnr) {
+				continue;
+			}
+
+			hop_limit = 1U;
+		}
+
+		ret = dns_write(ctx, j, query_idx, dns_data, dns_qname,
+				hop_limit);
+		if (ret < 0) {
+			failure++;
+			continue;
+		}
+
+		/* Do one concurrent query only for each name resolve.
+		 * TODO: Change the i (query index) to do multiple concurrent
+		 *       to each server.
+		 */
+		break;
+	}
+
+	if (failure) {
+		NET_DBG("DNS query failed %d times", failure);
+
+		if (failure == j) {
+			ret = -ENOENT;
+			goto quit;
+		}
+	}
+
+	ret = 0;
+
+quit:
+	if (dns_data) {
+		net_buf_unref(dns_data);
+	}
+
+	if (dns_qname) {
+		net_buf_unref(dns_qname);
+	}
+
+	return ret;
+}
+
+/* Find a new primary for the queries that were coalesced with a query
+ * released before it got its answer. The first of them sends the question
+ * again, and the other ones wait for its answer.
+ *
+ * Must be invoked with context lock held.
+ */
+static void rehome_queries(struct dns_resolve_context *ctx, int query_idx)
+{
+	int primary = -1;
+	int i, ret;
+
+	for (i = 0; i < CONFIG_DNS_NUM_CONCUR_QUERIES; i++) {
+		if (!is_coalesced(ctx, i, query_idx)) {
+			continue;
+		}
+
+		if (primary < 0) {
+			primary = i;
+		}
+
+		ctx->queries[i].primary = (i == primary) ? -1 : primary;
+	}
+
+	if (primary < 0) {
+		return;
+	}
+
+	NET_DBG("[%u] takes over query %u", primary, ctx->queries[query_idx].id);
+
+	ret = dns_send_query(ctx, primary);
+	if (ret < 0) {
+		invoke_query_callbacks(ctx, DNS_EAI_SYSTEM, NULL, primary);
+		release_queries(ctx, primary);
+	}
+}
+
 /* Must be invoked with context lock held */
 static void dns_resolve_cancel_slot(struct dns_resolve_context *ctx, int slot)
 {
@@ -998,6 +1279,11 @@ static int dns_resolve_cancel_with_hash(struct dns_resolve_context *ctx,
 
 	dns_resolve_cancel_slot(ctx, i);
 
+	/* The queries waiting for the answer of the canceled one, because of
+	 * a timeout, a CNAME or a cancel by its user, still need it.
+	 */
+	rehome_queries(ctx, i);
+
 unlock:
 	k_mutex_unlock(&ctx->lock);
 
@@ -1105,6 +1391,44 @@ static void query_timeout(struct k_work *work)
 	k_mutex_unlock(&pending_query->ctx->lock);
 }
 
+/* Answer a query from the cache. Returns true if the callback was called
+ * with the final result.
+ */
+static bool dns_resolve_from_cache(struct dns_resolve_context *ctx,
+				   const char *query,
+				   enum dns_query_type type,
+				   dns_resolve_cb_t cb,
+				   void *user_data)
+{
+	struct sockaddr addr[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES];
+	struct dns_addrinfo info = { 0 };
+	int count, i;
+
+	if (!is_cacheable_query(query)) {
+		return false;
+	}
+
+	count = dns_cache_find(ctx, query, type, addr, ARRAY_SIZE(addr));
+	if (count < 0) {
+		return false;
+	}
+
+	NET_DBG("%d cached address(es) for %s", count, query);
+
+	for (i = 0; i < count; i++) {
+		memcpy(&info.ai_addr, &addr[i], sizeof(info.ai_addr));
+		info.ai_family = addr[i].sa_family;
+		info.ai_addrlen = addr[i].sa_family == AF_INET6 ?
+			sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+
+		cb(DNS_EAI_INPROGRESS, &info, user_data);
+	}
+
+	cb(count > 0 ? DNS_EAI_ALLDONE : DNS_EAI_NODATA, NULL, user_data);
+
+	return true;
+}
+
 int dns_resolve_name(struct dns_resolve_context *ctx,
 		     const char *query,
 		     enum dns_query_type type,
@@ -1114,13 +1438,9 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 		     int32_t timeout)
 {
 	k_timeout_t tout;
-	struct net_buf *dns_data = NULL;
-	struct net_buf *dns_qname = NULL;
 	struct sockaddr addr;
 	int ret, i = -1, j = 0;
-	int failure = 0;
 	bool mdns_query = false;
-	uint8_t hop_limit;
 
 	if (!ctx || !query || !cb) {
 		return -EINVAL;
@@ -1182,6 +1502,15 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	}
 
 try_resolve:
+	if (IS_ENABLED(CONFIG_DNS_RESOLVER_CACHE) &&
+	    dns_resolve_from_cache(ctx, query, type, cb, user_data)) {
+		if (dns_id) {
+			*dns_id = 0U;
+		}
+
+		return 0;
+	}
+
 	k_mutex_lock(&ctx->lock, K_FOREVER);
 
 	if (ctx->state != DNS_RESOLVE_CONTEXT_ACTIVE) {
@@ -1202,42 +1531,20 @@ try_resolve:
 	ctx->queries[i].user_data = user_data;
 	ctx->queries[i].ctx = ctx;
 	ctx->queries[i].query_hash = 0;
+	ctx->queries[i].primary = -1;
 
 	k_work_init_delayable(&ctx->queries[i].timer, query_timeout);
 
-	dns_data = net_buf_alloc(&dns_msg_pool, ctx->buf_timeout);
-	if (!dns_data) {
-		ret = -ENOMEM;
-		goto quit;
-	}
-
-	dns_qname = net_buf_alloc(&dns_qname_pool, ctx->buf_timeout);
-	if (!dns_qname) {
-		ret = -ENOMEM;
-		goto quit;
-	}
-
-	ret = dns_msg_pack_qname(&dns_qname->len, dns_qname->data,
-				DNS_MAX_NAME_LEN, ctx->queries[i].query);
-	if (ret < 0) {
-		goto quit;
-	}
-
 	ctx->queries[i].id = sys_rand32_get();
 
 	/* If mDNS is enabled, then send .local queries only to multicast
 	 * address. For mDNS the id should be set to 0, see RFC 6762 ch. 18.1
 	 * for details.
 	 */
-	if (IS_ENABLED(CONFIG_MDNS_RESOLVER)) {
-		const char *ptr = strrchr(query, '.');
-
-		/* Note that we memcmp() the \0 here too */
-		if (ptr && !memcmp(ptr, (const void *){ ".local" }, 7)) {
-			mdns_query = true;
+	if (is_mdns_query(query)) {
+		mdns_query = true;
 
-			ctx->queries[i].id = 0;
-		}
+		ctx->queries[i].id = 0;
 	}
 
 	/* Do this immediately after calculating the Id so that the unit
@@ -1249,55 +1556,27 @@ try_resolve:
 		NET_DBG("DNS id will be %u", *dns_id);
 	}
 
-	for (j = 0; j < SERVER_COUNT; j++) {
-		hop_limit = 0U;
-
-		if (!ctx->servers[j].net_ctx) {
-			continue;
-		}
-
-		/* If mDNS is enabled, then send .local queries only to
-		 * a well known multicast mDNS server address.
-		 */
-		if (IS_ENABLED(CONFIG_MDNS_RESOLVER) && mdns_query &&
-		    !ctx->servers[j].is_mdns) {
-			continue;
-		}
-
-		/* If llmnr is enabled, then all the queries are sent to
-		 * LLMNR multicast address unless it is a mDNS query.
-		 */
-		if (!mdns_query && IS_ENABLED(CONFIG_LLMNR_RESOLVER)) {
-			if (!ctx->servers[j].is_llmnr) {
-				continue;
-			}
+	/* If the same question is already being asked, wait for its answer
+	 * instead of sending another query. The mDNS queries all have id 0,
+	 * so the answer could not be told apart from the coalesced ones.
+	 */
+	j = mdns_query ? -ENOENT : get_slot_by_query(ctx, i);
+	if (j >= 0) {
+		NET_DBG("[%u] coalesced with query %u for %s", i,
+			ctx->queries[j].id, query);
 
-			hop_limit = 1U;
-		}
+		ctx->queries[i].query_hash = ctx->queries[j].query_hash;
+		ctx->queries[i].primary = j;
 
-		ret = dns_write(ctx, j, i, dns_data, dns_qname, hop_limit);
-		if (ret < 0) {
-			failure++;
-			continue;
+		ret = k_work_reschedule(&ctx->queries[i].timer, tout);
+		if (ret >= 0) {
+			ret = 0;
 		}
 
-		/* Do one concurrent query only for each name resolve.
-		 * TODO: Change the i (query index) to do multiple concurrent
-		 *       to each server.
-		 */
-		break;
-	}
-
-	if (failure) {
-		NET_DBG("DNS query failed %d times", failure);
-
-		if (failure == j) {
-			ret = -ENOENT;
-			goto quit;
-		}
+		goto quit;
 	}
 
-	ret = 0;
+	ret = dns_send_query(ctx, i);
 
 quit:
 	if (ret < 0) {
@@ -1310,14 +1589,6 @@ quit:
 		}
 	}
 
-	if (dns_data) {
-		net_buf_unref(dns_data);
-	}
-
-	if (dns_qname) {
-		net_buf_unref(dns_qname);
-	}
-
 fail:
 	k_mutex_unlock(&ctx->lock);
 
@@ -1370,6 +1641,11 @@ static int dns_resolve_close_locked(struct dns_resolve_context *ctx)
 
 	k_mutex_lock(&ctx->lock, K_FOREVER);
 
+	if (IS_ENABLED(CONFIG_DNS_RESOLVER_CACHE)) {
+		/* New servers, if any, may give different answers */
+		dns_cache_flush_ctx(ctx);
+	}
+
 	ctx->state = DNS_RESOLVE_CONTEXT_INACTIVE;
 
 	return 0;
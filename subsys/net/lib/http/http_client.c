@@ -29,6 +29,12 @@ LOG_MODULE_REGISTER(net_http, CONFIG_NET_HTTP_LOG_LEVEL);
 #define HTTP_CONTENT_LEN_SIZE 11
 #define MAX_SEND_BUF_LEN 192
 
+/* Milliseconds since the start of the request */
+static uint32_t req_elapsed(struct http_request *req)
+{
+	return (uint32_t)(k_uptime_get() - req->internal.start);
+}
+
 static int sendall(int sock, const void *buf, size_t len)
 {
 	while (len) {
@@ -261,6 +267,10 @@ static int on_body(struct http_parser *parser, const char *at, size_t length)
 						struct http_request,
 						internal.parser);
 
+	if (req->internal.response.skip_body) {
+		return 0;
+	}
+
 	req->internal.response.body_found = 1;
 	req->internal.response.processed += length;
 
@@ -295,15 +305,23 @@ static int on_headers_complete(struct http_parser *parser)
 		req->internal.response.http_cb->on_headers_complete(parser);
 	}
 
-	if (parser->status_code >= 500 && parser->status_code < 600) {
-		NET_DBG("Status %d, skipping body", parser->status_code);
+	/* A response to HEAD never has a body, whatever its headers say. */
+	if (req->method == HTTP_HEAD) {
+		NET_DBG("No body expected");
 		return 1;
 	}
 
-	if ((req->method == HTTP_HEAD || req->method == HTTP_OPTIONS) &&
-	    req->internal.response.content_length > 0) {
-		NET_DBG("No body expected");
-		return 1;
+	/* Other bodies that are not given to the application are still read
+	 * from the socket, so that the connection can be used for the next
+	 * request.
+	 */
+	if (parser->status_code >= 500 && parser->status_code < 600) {
+		NET_DBG("Status %d, skipping body", parser->status_code);
+		req->internal.response.skip_body = 1;
+	} else if (req->method == HTTP_OPTIONS &&
+		   req->internal.response.content_length > 0) {
+		NET_DBG("Skipping body");
+		req->internal.response.skip_body = 1;
 	}
 
 	NET_DBG("Headers complete");
@@ -343,6 +361,7 @@ static int on_message_complete(struct http_parser *parser)
 		http_method_str(req->method));
 
 	req->internal.response.message_complete = 1;
+	req->internal.response.keep_alive = http_should_keep_alive(parser);
 
 	return 0;
 }
@@ -398,6 +417,8 @@ static void http_data_final_null_resp(struct http_request *req)
 		NET_DBG("Calling callback for Final Data"
 			"(NULL HTTP response)");
 
+		req->internal.response.timing.done = req_elapsed(req);
+
 		/* Status code 0 representing a null response */
 		req->internal.response.http_status_code = 0;
 
@@ -447,17 +468,22 @@ static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
 		} else if (fds[0].revents & ZSOCK_POLLHUP) {
 			/* Connection closed */
 			LOG_DBG("Connection closed");
-			goto finalize_data;
+			goto closed;
 		} else if (fds[0].revents & ZSOCK_POLLIN) {
 			received = zsock_recv(sock, req->internal.response.recv_buf + offset,
 					      req->internal.response.recv_buf_len - offset, 0);
 			if (received == 0) {
 				/* Connection closed */
 				LOG_DBG("Connection closed");
-				goto finalize_data;
+				goto closed;
 			} else if (received < 0) {
 				goto error;
 			} else {
+				if (total_received == 0) {
+					req->internal.response.timing.first_byte =
+						req_elapsed(req);
+				}
+
 				req->internal.response.data_len += received;
 
 				(void)http_parser_execute(
@@ -480,6 +506,8 @@ static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
 					NET_DBG("Calling callback for %zd len data",
 						req->internal.response.data_len);
 
+					req->internal.response.timing.done =
+						req_elapsed(req);
 					notify = true;
 					event = HTTP_DATA_FINAL;
 				} else if (offset == 0) {
@@ -511,6 +539,14 @@ static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
 
 	return ret;
 
+closed:
+	/* The server closed a connection it had kept open before it got the
+	 * request. The caller can send the request again on a new one.
+	 */
+	if (req->internal.reused && total_received == 0) {
+		return -ECONNRESET;
+	}
+
 finalize_data:
 	ret = total_received;
 
@@ -520,25 +556,24 @@ finalize_data:
 error:
 	LOG_DBG("Connection error (%d)", errno);
 	ret = -errno;
+
+	/* Part of the response was received, it must not be asked again */
+	if (ret == -ECONNRESET && total_received > 0) {
+		ret = -ECONNABORTED;
+	}
+
 	return ret;
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+static bool http_req_valid(struct http_request *req)
 {
-	/* Utilize the network usage by sending data in bigger blocks */
-	char send_buf[MAX_SEND_BUF_LEN];
-	const size_t send_buf_max_len = sizeof(send_buf);
-	size_t send_buf_pos = 0;
-	int total_sent = 0;
-	int ret, total_recv, i;
-	const char *method;
-
-	if (sock < 0 || req == NULL || req->response == NULL ||
-	    req->recv_buf == NULL || req->recv_buf_len == 0) {
-		return -EINVAL;
-	}
+	return req != NULL && req->response != NULL &&
+	       req->recv_buf != NULL && req->recv_buf_len != 0;
+}
 
+static void http_req_init(int sock, struct http_request *req,
+			  void *user_data, int64_t start, bool reused)
+{
 	memset(&req->internal.response, 0, sizeof(req->internal.response));
 
 	req->internal.response.http_cb = req->http_cb;
@@ -547,6 +582,27 @@ int http_client_req(int sock, struct http_request *req,
 	req->internal.response.recv_buf_len = req->recv_buf_len;
 	req->internal.user_data = user_data;
 	req->internal.sock = sock;
+	req->internal.start = start;
+	req->internal.reused = reused;
+}
+
+/* Send the request and wait for the response. The result of the wait is
+ * stored in total_recv.
+ */
+static int http_req_send(struct http_request *req, int32_t timeout,
+			 int *total_recv)
+{
+	/* Utilize the network usage by sending data in bigger blocks */
+	char send_buf[MAX_SEND_BUF_LEN];
+	const size_t send_buf_max_len = sizeof(send_buf);
+	size_t send_buf_pos = 0;
+	int sock = req->internal.sock;
+	void *user_data = req->internal.user_data;
+	int total_sent = 0;
+	int ret, i;
+	const char *method;
+
+	*total_recv = 0;
 
 	method = http_method_str(req->method);
 
@@ -710,15 +766,17 @@ int http_client_req(int sock, struct http_request *req,
 
 	NET_DBG("Sent %d bytes", total_sent);
 
+	req->internal.response.timing.sent = req_elapsed(req);
+
 	http_client_init_parser(&req->internal.parser,
 				&req->internal.parser_settings);
 
 	/* Request is sent, now wait data to be received */
-	total_recv = http_wait_data(sock, req, timeout);
-	if (total_recv < 0) {
-		NET_DBG("Wait data failure (%d)", total_recv);
+	*total_recv = http_wait_data(sock, req, timeout);
+	if (*total_recv < 0) {
+		NET_DBG("Wait data failure (%d)", *total_recv);
 	} else {
-		NET_DBG("Received %d bytes", total_recv);
+		NET_DBG("Received %d bytes", *total_recv);
 	}
 
 	return total_sent;
@@ -726,3 +784,109 @@ int http_client_req(int sock, struct http_request *req,
 out:
 	return ret;
 }
+
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	int total_recv;
+
+	if (sock < 0 || !http_req_valid(req)) {
+		return -EINVAL;
+	}
+
+	http_req_init(sock, req, user_data, k_uptime_get(), false);
+
+	return http_req_send(req, timeout, &total_recv);
+}
+
+void http_client_conn_init(struct http_client_conn *conn,
+			   http_connect_cb_t connect)
+{
+	memset(conn, 0, sizeof(*conn));
+
+	conn->connect = connect;
+	conn->sock = -1;
+}
+
+void http_client_conn_close(struct http_client_conn *conn)
+{
+	if (conn->sock >= 0) {
+		(void)zsock_close(conn->sock);
+		conn->sock = -1;
+	}
+}
+
+/* Errors with which a connection closed by the server fails a send */
+static bool http_conn_lost(int err)
+{
+	return err == -ECONNRESET || err == -EPIPE || err == -ENOTCONN;
+}
+
+/* Methods which may be sent again without changing the effect on the
+ * server, see RFC 9110 section 9.2.2.
+ */
+static bool http_method_idempotent(enum http_method method)
+{
+	switch (method) {
+	case HTTP_GET:
+	case HTTP_HEAD:
+	case HTTP_OPTIONS:
+	case HTTP_TRACE:
+	case HTTP_PUT:
+	case HTTP_DELETE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+int http_client_conn_req(struct http_client_conn *conn,
+			 struct http_request *req,
+			 int32_t timeout, void *user_data)
+{
+	int64_t start = k_uptime_get();
+	int total_recv;
+	bool reused;
+	int ret;
+
+	if (conn == NULL || conn->connect == NULL || !http_req_valid(req)) {
+		return -EINVAL;
+	}
+
+	do {
+		reused = conn->sock >= 0;
+		if (!reused) {
+			ret = conn->connect(conn, user_data);
+			if (ret < 0) {
+				NET_DBG("Cannot connect (%d)", ret);
+				return ret;
+			}
+
+			conn->sock = ret;
+			conn->connections++;
+		}
+
+		http_req_init(conn->sock, req, user_data, start, reused);
+
+		if (!reused) {
+			req->internal.response.timing.connected =
+				req_elapsed(req);
+		}
+
+		conn->requests++;
+
+		ret = http_req_send(req, timeout, &total_recv);
+		if (ret < 0 || total_recv < 0 ||
+		    !req->internal.response.keep_alive) {
+			http_client_conn_close(conn);
+		}
+
+		/* A connection kept open may have been closed by the server
+		 * in the meantime. Only then is the request sent again, and
+		 * only if the server may safely have processed it twice.
+		 */
+	} while (reused && http_method_idempotent(req->method) &&
+		 (http_conn_lost(ret) || total_recv == -ECONNRESET));
+
+	return ret;
+}
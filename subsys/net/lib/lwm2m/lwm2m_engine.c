@@ -536,32 +536,54 @@ void lwm2m_socket_del(struct lwm2m_ctx *ctx)
 static void check_notifications(struct lwm2m_ctx *ctx, const int64_t timestamp)
 {
 	struct observe_node *obs;
+	int64_t next = INT64_MAX;
 	int rc;
 
 	lwm2m_registry_lock();
+	if (timestamp < ctx->next_notify_timestamp) {
+		goto unlock;
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
-		if (!obs->event_timestamp || timestamp < obs->event_timestamp) {
+		if (!obs->event_timestamp) {
+			continue;
+		}
+
+		if (timestamp < obs->event_timestamp) {
+			next = MIN(next, obs->event_timestamp);
 			continue;
 		}
 		/* Check That There is not pending process*/
 		if (obs->active_tx_operation) {
+			next = timestamp;
 			continue;
 		}
 
 		rc = generate_notify_message(ctx, obs, NULL);
 		if (rc == -ENOMEM) {
 			/* no memory/messages available, retry later */
+			next = timestamp;
 			goto cleanup;
 		}
+		if (rc < 0) {
+			/* The update is dropped, let later changes schedule a new one */
+			obs->resource_update = false;
+		}
 		obs->event_timestamp =
 			engine_observe_shedule_next_event(obs, ctx->srv_obj_inst, timestamp);
 		obs->last_timestamp = timestamp;
 		if (!rc) {
 			/* create at most one notification */
+			next = timestamp;
 			goto cleanup;
 		}
+		if (obs->event_timestamp) {
+			next = MIN(next, obs->event_timestamp);
+		}
 	}
 cleanup:
+	ctx->next_notify_timestamp = next;
+unlock:
 	lwm2m_registry_unlock();
 }
 
@@ -696,6 +718,12 @@ static void socket_loop(void)
 			    sys_slist_is_empty(&sock_ctx[i]->pending_sends) &&
 			    lwm2m_rd_client_is_registred(sock_ctx[i])) {
 				check_notifications(sock_ctx[i], timestamp);
+
+				/* Wake up in time for the next due notification */
+				if (sock_ctx[i]->next_notify_timestamp > timestamp &&
+				    sock_ctx[i]->next_notify_timestamp - timestamp < timeout) {
+					timeout = sock_ctx[i]->next_notify_timestamp - timestamp;
+				}
 			}
 		}
 
@@ -79,6 +79,16 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 /* Shared set of in-flight LwM2M messages */
 static struct lwm2m_message messages[CONFIG_LWM2M_ENGINE_MAX_MESSAGES];
+
+/* Index of the messages waiting for a response, so that received responses
+ * and retransmissions do not need to go through all the messages. Messages
+ * with a pending are indexed by the message ID of the pending, messages with
+ * a reply by the token of the reply, or its message ID if it has no token.
+ */
+#define MSG_INDEX_BUCKETS (CONFIG_LWM2M_ENGINE_MAX_MESSAGES + 1)
+
+static sys_slist_t msg_pending_index[MSG_INDEX_BUCKETS];
+static sys_slist_t msg_reply_index[MSG_INDEX_BUCKETS];
 static struct lwm2m_block_context block1_contexts[NUM_BLOCK1_CONTEXT];
 
 #if defined(CONFIG_LWM2M_COAP_BLOCK_TRANSFER)
@@ -436,6 +446,7 @@ void lwm2m_engine_context_init(struct lwm2m_ctx *client_ctx)
 {
 	sys_slist_init(&client_ctx->pending_sends);
 	sys_slist_init(&client_ctx->observer);
+	client_ctx->next_notify_timestamp = 0;
 	client_ctx->connection_suspended = false;
 #if defined(CONFIG_LWM2M_QUEUE_MODE_ENABLED)
 	client_ctx->buffer_client_messages = true;
@@ -463,33 +474,101 @@ static int coap_options_to_path(struct coap_option *opt, int options_count,
 	return options_count == path->level ? 0 : -EINVAL;
 }
 
+static sys_slist_t *msg_pending_bucket(uint16_t id)
+{
+	return &msg_pending_index[id % MSG_INDEX_BUCKETS];
+}
+
+static sys_slist_t *msg_reply_bucket(const uint8_t *token, uint8_t tkl, uint16_t id)
+{
+	if (tkl == 0U) {
+		return &msg_reply_index[id % MSG_INDEX_BUCKETS];
+	}
+
+	return &msg_reply_index[lwm2m_token_hash(token, tkl) % MSG_INDEX_BUCKETS];
+}
+
+static void msg_index_add(struct lwm2m_message *msg)
+{
+	if (msg->pending) {
+		sys_slist_append(msg_pending_bucket(msg->pending->id), &msg->pending_node);
+	}
+
+	if (msg->reply) {
+		sys_slist_append(msg_reply_bucket(msg->reply->token, msg->reply->tkl,
+						  msg->reply->id),
+				 &msg->reply_node);
+	}
+}
+
+static void msg_index_del(struct lwm2m_message *msg)
+{
+	if (msg->pending) {
+		sys_slist_find_and_remove(msg_pending_bucket(msg->pending->id),
+					  &msg->pending_node);
+	}
+
+	if (msg->reply) {
+		sys_slist_find_and_remove(msg_reply_bucket(msg->reply->token, msg->reply->tkl,
+							   msg->reply->id),
+					  &msg->reply_node);
+	}
+}
+
 struct lwm2m_message *find_msg(struct coap_pending *pending, struct coap_reply *reply)
 {
-	size_t i;
 	struct lwm2m_message *msg;
 
-	if (!pending && !reply) {
+	if (pending != NULL) {
+		SYS_SLIST_FOR_EACH_CONTAINER(msg_pending_bucket(pending->id), msg, pending_node) {
+			if (msg->pending == pending) {
+				return msg;
+			}
+		}
+
 		return NULL;
 	}
 
-	msg = lwm2m_get_ongoing_rd_msg();
-	if (msg) {
-		if (pending != NULL && msg->pending == pending) {
-			return msg;
+	if (reply != NULL) {
+		SYS_SLIST_FOR_EACH_CONTAINER(msg_reply_bucket(reply->token, reply->tkl, reply->id),
+					     msg, reply_node) {
+			if (msg->reply == reply) {
+				return msg;
+			}
 		}
+	}
+
+	return NULL;
+}
+
+struct lwm2m_message *find_msg_by_mid(struct lwm2m_ctx *client_ctx, uint16_t mid)
+{
+	struct lwm2m_message *msg;
 
-		if (reply != NULL && msg->reply == reply) {
+	SYS_SLIST_FOR_EACH_CONTAINER(msg_pending_bucket(mid), msg, pending_node) {
+		if (msg->ctx == client_ctx && msg->pending->id == mid) {
 			return msg;
 		}
 	}
 
-	for (i = 0; i < CONFIG_LWM2M_ENGINE_MAX_MESSAGES; i++) {
-		if (pending != NULL && messages[i].ctx && messages[i].pending == pending) {
-			return &messages[i];
+	return NULL;
+}
+
+struct lwm2m_message *find_msg_by_token(struct lwm2m_ctx *client_ctx, const uint8_t *token,
+					uint8_t tkl, uint16_t mid)
+{
+	struct lwm2m_message *msg;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(msg_reply_bucket(token, tkl, mid), msg, reply_node) {
+		if (msg->ctx != client_ctx || msg->reply->tkl != tkl) {
+			continue;
 		}
 
-		if (reply != NULL && messages[i].ctx && messages[i].reply == reply) {
-			return &messages[i];
+		/* Piggybacked responses must match the message ID when
+		 * there is no token.
+		 */
+		if (tkl == 0U ? msg->reply->id == mid : !memcmp(msg->reply->token, token, tkl)) {
+			return msg;
 		}
 	}
 
@@ -512,6 +591,8 @@ struct lwm2m_message *lwm2m_get_message(struct lwm2m_ctx *client_ctx)
 
 void lm2m_message_clear_allocations(struct lwm2m_message *msg)
 {
+	msg_index_del(msg);
+
 	if (msg->pending) {
 		coap_pending_clear(msg->pending);
 		msg->pending = NULL;
@@ -642,6 +723,8 @@ int lwm2m_init_message(struct lwm2m_message *msg)
 		msg->reply->reply = msg->reply_cb;
 	}
 
+	msg_index_add(msg);
+
 	return 0;
 
 cleanup:
@@ -2486,6 +2569,8 @@ static int lwm2m_response_promote_to_con(struct lwm2m_message *msg)
 	msg->cpkt.data[2] = msg->mid >> 8;
 	msg->cpkt.data[3] = (uint8_t)msg->mid;
 
+	msg_index_del(msg);
+
 	if (msg->pending) {
 		coap_pending_clear(msg->pending);
 	}
@@ -2495,7 +2580,8 @@ static int lwm2m_response_promote_to_con(struct lwm2m_message *msg)
 	if (!msg->pending) {
 		LOG_ERR("Unable to find a free pending to track "
 			"retransmissions.");
-		return -ENOMEM;
+		ret = -ENOMEM;
+		goto out;
 	}
 
 	ret = coap_pending_init(msg->pending, &msg->cpkt, &msg->ctx->remote_addr,
@@ -2506,6 +2592,9 @@ static int lwm2m_response_promote_to_con(struct lwm2m_message *msg)
 			ret);
 	}
 
+out:
+	msg_index_add(msg);
+
 	return ret;
 }
 
@@ -2518,6 +2607,7 @@ void lwm2m_udp_receive(struct lwm2m_ctx *client_ctx, uint8_t *buf, uint16_t buf_
 	struct coap_packet response;
 	int r;
 	uint8_t token[8];
+	uint8_t tkl;
 #if defined(CONFIG_LWM2M_COAP_BLOCK_TRANSFER)
 	bool more_blocks = false;
 	uint8_t block_num;
@@ -2530,17 +2620,12 @@ void lwm2m_udp_receive(struct lwm2m_ctx *client_ctx, uint8_t *buf, uint16_t buf_
 		return;
 	}
 
-	(void)coap_header_get_token(&response, token);
-	pending = coap_pending_received(&response, client_ctx->pendings,
-					ARRAY_SIZE(client_ctx->pendings));
-	if (pending && coap_header_get_type(&response) == COAP_TYPE_ACK) {
-		msg = find_msg(pending, NULL);
-		if (msg == NULL) {
-			LOG_DBG("Orphaned pending %p.", pending);
-			coap_pending_clear(pending);
-			return;
-		}
+	tkl = coap_header_get_token(&response, token);
 
+	/* Only the message the ID or token refers to has to be matched */
+	msg = find_msg_by_mid(client_ctx, coap_header_get_id(&response));
+	pending = msg ? coap_pending_received(&response, msg->pending, 1) : NULL;
+	if (pending && coap_header_get_type(&response) == COAP_TYPE_ACK) {
 		msg->acknowledged = true;
 
 		if (msg->reply == NULL) {
@@ -2559,10 +2644,9 @@ void lwm2m_udp_receive(struct lwm2m_ctx *client_ctx, uint8_t *buf, uint16_t buf_
 		}
 	}
 
-	reply = coap_response_received(&response, from_addr, client_ctx->replies,
-				       ARRAY_SIZE(client_ctx->replies));
+	msg = find_msg_by_token(client_ctx, token, tkl, coap_header_get_id(&response));
+	reply = msg ? coap_response_received(&response, from_addr, msg->reply, 1) : NULL;
 	if (reply) {
-		msg = find_msg(NULL, reply);
 
 		if (coap_header_get_type(&response) == COAP_TYPE_CON) {
 			r = lwm2m_send_empty_ack(client_ctx, coap_header_get_id(&response));
@@ -2687,10 +2771,8 @@ static void notify_message_timeout_cb(struct lwm2m_message *msg)
 	if (msg->ctx != NULL) {
 		struct observe_node *obs;
 		struct lwm2m_ctx *client_ctx = msg->ctx;
-		sys_snode_t *prev_node = NULL;
 
-		obs = engine_observe_node_discover(&client_ctx->observer, &prev_node, NULL,
-						   msg->token, msg->tkl);
+		obs = engine_observe_node_find_by_token(client_ctx, msg->token, msg->tkl);
 
 		if (obs) {
 			obs->active_tx_operation = false;
@@ -2739,7 +2821,6 @@ static int notify_message_reply_cb(const struct coap_packet *response, struct co
 	uint8_t type, code;
 	struct lwm2m_message *msg;
 	struct observe_node *obs;
-	sys_snode_t *prev_node = NULL;
 
 	type = coap_header_get_type(response);
 	code = coap_header_get_code(response);
@@ -2761,8 +2842,7 @@ static int notify_message_reply_cb(const struct coap_packet *response, struct co
 			LOG_ERR("notify reply missing token -- ignored.");
 		}
 	} else {
-		obs = engine_observe_node_discover(&msg->ctx->observer, &prev_node, NULL,
-						   reply->token, reply->tkl);
+		obs = engine_observe_node_find_by_token(msg->ctx, reply->token, reply->tkl);
 
 		if (obs) {
 			obs->active_tx_operation = false;
@@ -44,6 +44,9 @@ typedef int (*udp_request_handler_cb_t)(struct coap_packet *request, struct lwm2
 /* LwM2M message functions */
 struct lwm2m_message *lwm2m_get_message(struct lwm2m_ctx *client_ctx);
 struct lwm2m_message *find_msg(struct coap_pending *pending, struct coap_reply *reply);
+struct lwm2m_message *find_msg_by_mid(struct lwm2m_ctx *client_ctx, uint16_t mid);
+struct lwm2m_message *find_msg_by_token(struct lwm2m_ctx *client_ctx, const uint8_t *token,
+					uint8_t tkl, uint16_t mid);
 void lwm2m_reset_message(struct lwm2m_message *msg, bool release);
 void lm2m_message_clear_allocations(struct lwm2m_message *msg);
 int lwm2m_init_message(struct lwm2m_message *msg);
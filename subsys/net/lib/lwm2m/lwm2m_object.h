@@ -192,6 +192,9 @@ struct lwm2m_engine_obj {
 	/* object list */
 	sys_snode_t node;
 
+	/* registry hash bucket */
+	sys_snode_t hash_node;
+
 	/* object field definitions */
 	struct lwm2m_engine_obj_field *fields;
 
@@ -412,6 +415,9 @@ struct lwm2m_engine_obj_inst {
 	/* instance list */
 	sys_snode_t node;
 
+	/* registry hash bucket */
+	sys_snode_t hash_node;
+
 	struct lwm2m_engine_obj *obj;
 	struct lwm2m_engine_res *resources;
 
@@ -504,6 +510,10 @@ struct lwm2m_message {
 	/** Message transmission handling for TYPE_CON */
 	struct coap_pending *pending;
 	struct coap_reply *reply;
+
+	/** Nodes in the indexes of the messages by pending and reply */
+	sys_snode_t pending_node;
+	sys_snode_t reply_node;
 #if defined(CONFIG_LWM2M_RESOURCE_DATA_CACHE_SUPPORT)
 	struct lwm2m_cache_read_info *cache_info;
 #endif
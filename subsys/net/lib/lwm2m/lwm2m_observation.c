@@ -64,6 +64,42 @@ static sys_slist_t obs_obj_path_list;
 
 static struct observe_node observe_node_data[CONFIG_LWM2M_ENGINE_MAX_OBSERVER];
 
+/* Index of the observers by their token, so that notification replies and
+ * timeouts find their observer without walking the observers.
+ */
+#define OBSERVER_TOKEN_BUCKETS CONFIG_LWM2M_ENGINE_MAX_OBSERVER
+
+static sys_slist_t observer_token_index[OBSERVER_TOKEN_BUCKETS];
+
+static sys_slist_t *observer_token_bucket(const uint8_t *token, uint8_t tkl)
+{
+	return &observer_token_index[lwm2m_token_hash(token, tkl) % OBSERVER_TOKEN_BUCKETS];
+}
+
+static void engine_observe_token_set(struct observe_node *obs, const uint8_t *token, uint8_t tkl)
+{
+	if (obs->tkl) {
+		sys_slist_find_and_remove(observer_token_bucket(obs->token, obs->tkl),
+					  &obs->token_node);
+	}
+
+	memcpy(obs->token, token, tkl);
+	obs->tkl = tkl;
+	sys_slist_append(observer_token_bucket(obs->token, obs->tkl), &obs->token_node);
+}
+
+/* Number of observed paths per object ID bucket, so that changes to objects
+ * nobody observes are dismissed without walking the observers.
+ */
+#define OBSERVED_OBJ_BUCKETS 32
+
+static uint16_t observed_obj_refs[OBSERVED_OBJ_BUCKETS];
+
+static inline uint16_t *observed_obj_ref(uint16_t obj_id)
+{
+	return &observed_obj_refs[obj_id % OBSERVED_OBJ_BUCKETS];
+}
+
 /* External resources */
 struct lwm2m_ctx **lwm2m_sock_ctx(void);
 
@@ -172,6 +208,16 @@ static bool lwm2m_observer_path_compare(const struct lwm2m_obj_path *o_p,
 	return true;
 }
 
+static void engine_observe_event_set(struct lwm2m_ctx *ctx, struct observe_node *obs,
+				     int64_t timestamp)
+{
+	obs->event_timestamp = timestamp;
+
+	if (timestamp && timestamp < ctx->next_notify_timestamp) {
+		ctx->next_notify_timestamp = timestamp;
+	}
+}
+
 static bool lwm2m_notify_observer_list(sys_slist_t *path_list, const struct lwm2m_obj_path *path)
 {
 	struct lwm2m_obj_path_list *o_p;
@@ -203,8 +249,9 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 	struct lwm2m_engine_obj *obj;
 	struct lwm2m_engine_obj_field *obj_field = NULL;
 	struct lwm2m_engine_obj_inst *obj_inst = NULL;
+	struct lwm2m_engine_res *res;
 	struct lwm2m_engine_res_inst *res_inst = NULL;
-	int ret, i;
+	int ret;
 
 	/* defaults from server object */
 	attrs->pmin = lwm2m_server_get_pmin(srv_obj_inst);
@@ -240,20 +287,15 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 
 	/* check if resource exists */
 	if (path->level >= LWM2M_PATH_LEVEL_RESOURCE) {
-		for (i = 0; i < obj_inst->resource_count; i++) {
-			if (obj_inst->resources[i].res_id == path->res_id) {
-				break;
-			}
-		}
-
-		if (i == obj_inst->resource_count) {
+		res = lwm2m_get_engine_res(obj_inst, path->res_id);
+		if (!res) {
 			LOG_ERR("unable to find res_id: %u/%u/%u", path->obj_id, path->obj_inst_id,
 				path->res_id);
 			return -ENOENT;
 		}
 
 		/* load object field data */
-		obj_field = lwm2m_get_engine_obj_field(obj, obj_inst->resources[i].res_id);
+		obj_field = lwm2m_get_engine_obj_field(obj, res->res_id);
 		if (!obj_field) {
 			LOG_ERR("unable to find obj_field: %u/%u/%u", path->obj_id,
 				path->obj_inst_id, path->res_id);
@@ -265,7 +307,7 @@ static int engine_observe_get_attributes(const struct lwm2m_obj_path *path,
 			return -EPERM;
 		}
 
-		ret = update_attrs(&obj_inst->resources[i], attrs);
+		ret = update_attrs(res, attrs);
 		if (ret < 0) {
 			return ret;
 		}
@@ -346,10 +388,22 @@ int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 		return 0;
 	}
 
+	if (!*observed_obj_ref(path->obj_id)) {
+		return 0;
+	}
+
 	/* look for observers which match our resource */
 	for (i = 0; i < lwm2m_sock_nfds(); ++i) {
 		SYS_SLIST_FOR_EACH_CONTAINER(&sock_ctx[i]->observer, obs, node) {
 			if (lwm2m_notify_observer_list(&obs->path_list, path)) {
+				/* Already due as early as pmin allows, the pending
+				 * notification reports this change as well.
+				 */
+				if (obs->resource_update && obs->event_timestamp) {
+					ret++;
+					continue;
+				}
+
 				/* update the event time for this observer */
 				ret = engine_observe_attribute_list_get(&obs->path_list, &nattrs,
 									sock_ctx[i]->srv_obj_inst);
@@ -367,7 +421,7 @@ int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path)
 
 				if (!obs->event_timestamp || obs->event_timestamp > timestamp) {
 					obs->resource_update = true;
-					obs->event_timestamp = timestamp;
+					engine_observe_event_set(sock_ctx[i], obs, timestamp);
 				}
 
 				LOG_DBG("NOTIFY EVENT %u/%u/%u", path->obj_id, path->obj_inst_id,
@@ -427,12 +481,12 @@ static void engine_observe_node_init(struct observe_node *obs, const uint8_t *to
 {
 	struct lwm2m_obj_path_list *tmp;
 
-	memcpy(obs->token, token, tkl);
-	obs->tkl = tkl;
+	obs->ctx = ctx;
+	engine_observe_token_set(obs, token, tkl);
 
 	obs->last_timestamp = k_uptime_get();
 	if (att_pmax) {
-		obs->event_timestamp = obs->last_timestamp + MSEC_PER_SEC * att_pmax;
+		engine_observe_event_set(ctx, obs, obs->last_timestamp + MSEC_PER_SEC * att_pmax);
 	} else {
 		obs->event_timestamp = 0;
 	}
@@ -446,6 +500,8 @@ static void engine_observe_node_init(struct observe_node *obs, const uint8_t *to
 		LOG_DBG("OBSERVER ADDED %u/%u/%u/%u(%u)", tmp->path.obj_id, tmp->path.obj_inst_id,
 			tmp->path.res_id, tmp->path.res_inst_id, tmp->path.level);
 
+		(*observed_obj_ref(tmp->path.obj_id))++;
+
 		if (ctx->observe_cb) {
 			ctx->observe_cb(LWM2M_OBSERVE_EVENT_OBSERVER_ADDED, &tmp->path, ctx);
 		}
@@ -464,6 +520,8 @@ static void remove_observer_path_from_list(struct lwm2m_ctx *ctx, struct observe
 	if (ctx->observe_cb) {
 		ctx->observe_cb(LWM2M_OBSERVE_EVENT_OBSERVER_REMOVED, &o_p->path, NULL);
 	}
+	(*observed_obj_ref(o_p->path.obj_id))--;
+
 	/* Remove from the list and add to free list */
 	sys_slist_remove(&obs->path_list, prev_node, &o_p->node);
 	sys_slist_append(&obs_obj_path_list, &o_p->node);
@@ -592,8 +650,7 @@ static int engine_add_observer(struct lwm2m_message *msg, const uint8_t *token,
 	obs = engine_observe_node_discover(&msg->ctx->observer, &prev_node, &lwm2m_path_list, NULL,
 					   0);
 	if (obs) {
-		memcpy(obs->token, token, tkl);
-		obs->tkl = tkl;
+		engine_observe_token_set(obs, token, tkl);
 
 		LOG_DBG("OBSERVER DUPLICATE %u/%u/%u(%u) [%s]", msg->path.obj_id,
 			msg->path.obj_inst_id, msg->path.res_id, msg->path.level,
@@ -675,8 +732,7 @@ static int engine_add_composite_observer(struct lwm2m_message *msg, const uint8_
 	obs = engine_observe_node_discover(&msg->ctx->observer, &prev_node, &lwm2m_path_list, NULL,
 					   0);
 	if (obs) {
-		memcpy(obs->token, token, tkl);
-		obs->tkl = tkl;
+		engine_observe_token_set(obs, token, tkl);
 
 		LOG_DBG("OBSERVER Composite DUPLICATE [%s]",
 			lwm2m_sprint_ip_addr(&msg->ctx->remote_addr));
@@ -706,9 +762,28 @@ void remove_observer_from_list(struct lwm2m_ctx *ctx, sys_snode_t *prev_node,
 		remove_observer_path_from_list(ctx, obs, o_p, NULL);
 	}
 	sys_slist_remove(&ctx->observer, prev_node, &obs->node);
+	sys_slist_find_and_remove(observer_token_bucket(obs->token, obs->tkl), &obs->token_node);
 	(void)memset(obs, 0, sizeof(*obs));
 }
 
+struct observe_node *engine_observe_node_find_by_token(struct lwm2m_ctx *ctx,
+						       const uint8_t *token, uint8_t tkl)
+{
+	struct observe_node *obs;
+
+	if (!token || (tkl == 0U || tkl > MAX_TOKEN_LEN)) {
+		return NULL;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(observer_token_bucket(token, tkl), obs, token_node) {
+		if (obs->ctx == ctx && obs->tkl == tkl && !memcmp(obs->token, token, tkl)) {
+			return obs;
+		}
+	}
+
+	return NULL;
+}
+
 int engine_remove_observer_by_token(struct lwm2m_ctx *ctx, const uint8_t *token, uint8_t tkl)
 {
 	struct observe_node *obs;
@@ -902,7 +977,7 @@ const char *lwm2m_engine_get_attr_name(const struct lwm2m_attr *attr)
 	return LWM2M_ATTR_STR[attr->type];
 }
 
-static int lwm2m_engine_observer_timestamp_update(sys_slist_t *observer,
+static int lwm2m_engine_observer_timestamp_update(struct lwm2m_ctx *ctx,
 						  const struct lwm2m_obj_path *path,
 						  uint16_t srv_obj_inst)
 {
@@ -912,7 +987,7 @@ static int lwm2m_engine_observer_timestamp_update(sys_slist_t *observer,
 	int64_t timestamp;
 
 	/* update observe_node accordingly */
-	SYS_SLIST_FOR_EACH_CONTAINER(observer, obs, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
 		if (obs->resource_update) {
 			/* Resource Update on going skip this*/
 			continue;
@@ -936,7 +1011,7 @@ static int lwm2m_engine_observer_timestamp_update(sys_slist_t *observer,
 			/* Disable Automatic Notify */
 			timestamp = 0;
 		}
-		obs->event_timestamp = timestamp;
+		engine_observe_event_set(ctx, obs, timestamp);
 
 		(void)memset(&nattrs, 0, sizeof(nattrs));
 	}
@@ -1356,8 +1431,7 @@ int lwm2m_write_attr_handler(struct lwm2m_engine_obj *obj, struct lwm2m_message
 		return 0;
 	}
 
-	lwm2m_engine_observer_timestamp_update(&msg->ctx->observer, &msg->path,
-					       msg->ctx->srv_obj_inst);
+	lwm2m_engine_observer_timestamp_update(msg->ctx, &msg->path, msg->ctx->srv_obj_inst);
 
 	return 0;
 }
@@ -1368,6 +1442,10 @@ bool lwm2m_path_is_observed(const struct lwm2m_obj_path *path)
 	struct observe_node *obs;
 	struct lwm2m_ctx **sock_ctx = lwm2m_sock_ctx();
 
+	if (path->level >= LWM2M_PATH_LEVEL_OBJECT && !*observed_obj_ref(path->obj_id)) {
+		return false;
+	}
+
 	for (i = 0; i < lwm2m_sock_nfds(); ++i) {
 		SYS_SLIST_FOR_EACH_CONTAINER(&sock_ctx[i]->observer, obs, node) {
 
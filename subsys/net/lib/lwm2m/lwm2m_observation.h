@@ -14,6 +14,8 @@ int lwm2m_notify_observer_path(const struct lwm2m_obj_path *path);
 
 struct observe_node {
 	sys_snode_t node;
+	sys_snode_t token_node;	      /* Node in the index by token */
+	struct lwm2m_ctx *ctx;	      /* Context of the observer */
 	sys_slist_t path_list;	      /* List of Observation path */
 	uint8_t token[MAX_TOKEN_LEN]; /* Observation Token */
 	int64_t event_timestamp;      /* Timestamp for trig next Notify  */
@@ -43,6 +45,9 @@ struct observe_node *engine_observe_node_discover(sys_slist_t *observe_node_list
 						  sys_slist_t *lwm2m_path_list,
 						  const uint8_t *token, uint8_t tkl);
 
+struct observe_node *engine_observe_node_find_by_token(struct lwm2m_ctx *ctx,
+						       const uint8_t *token, uint8_t tkl);
+
 int engine_remove_observer_by_token(struct lwm2m_ctx *ctx, const uint8_t *token, uint8_t tkl);
 
 int lwm2m_write_attr_handler(struct lwm2m_engine_obj *obj, struct lwm2m_message *msg);
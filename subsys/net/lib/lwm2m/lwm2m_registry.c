@@ -54,6 +54,23 @@ void lwm2m_registry_unlock(void)
 static sys_slist_t engine_obj_list;
 static sys_slist_t engine_obj_inst_list;
 
+/* Objects and object instances are also hashed by their IDs, so that path
+ * lookups do not need to walk the whole registry.
+ */
+#define REGISTRY_BUCKETS CONFIG_LWM2M_ENGINE_REGISTRY_BUCKETS
+
+static sys_slist_t engine_obj_buckets[REGISTRY_BUCKETS];
+static sys_slist_t engine_obj_inst_buckets[REGISTRY_BUCKETS];
+
+static inline sys_slist_t *registry_bucket(sys_slist_t *buckets, uint16_t obj_id,
+					   uint16_t obj_inst_id)
+{
+	uint32_t key = ((uint32_t)obj_id << 16) | obj_inst_id;
+
+	/* Fibonacci hashing, keeping the well mixed upper bits */
+	return &buckets[((key * 2654435761U) >> 16) % REGISTRY_BUCKETS];
+}
+
 /* Resource wrappers */
 sys_slist_t *lwm2m_engine_obj_list(void) { return &engine_obj_list; }
 
@@ -78,6 +95,7 @@ void lwm2m_register_obj(struct lwm2m_engine_obj *obj)
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
 	sys_slist_append(&engine_obj_list, &obj->node);
+	sys_slist_append(registry_bucket(engine_obj_buckets, obj->obj_id, 0), &obj->hash_node);
 	k_mutex_unlock(&registry_lock);
 }
 
@@ -89,6 +107,8 @@ void lwm2m_unregister_obj(struct lwm2m_engine_obj *obj)
 #endif
 	engine_remove_observer_by_id(obj->obj_id, -1);
 	sys_slist_find_and_remove(&engine_obj_list, &obj->node);
+	sys_slist_find_and_remove(registry_bucket(engine_obj_buckets, obj->obj_id, 0),
+				  &obj->hash_node);
 	k_mutex_unlock(&registry_lock);
 }
 
@@ -96,7 +116,12 @@ struct lwm2m_engine_obj *get_engine_obj(int obj_id)
 {
 	struct lwm2m_engine_obj *obj;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_list, obj, node) {
+	if (obj_id < 0 || obj_id > UINT16_MAX) {
+		return NULL;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(registry_bucket(engine_obj_buckets, obj_id, 0), obj,
+				     hash_node) {
 		if (obj->obj_id == obj_id) {
 			return obj;
 		}
@@ -110,6 +135,12 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 	int i;
 
 	if (obj && obj->fields && obj->field_count > 0) {
+		/* Fields are usually defined in resource ID order without gaps */
+		if (res_id >= 0 && res_id < obj->field_count &&
+		    obj->fields[res_id].res_id == res_id) {
+			return &obj->fields[res_id];
+		}
+
 		for (i = 0; i < obj->field_count; i++) {
 			if (obj->fields[i].res_id == res_id) {
 				return &obj->fields[i];
@@ -120,6 +151,29 @@ struct lwm2m_engine_obj_field *lwm2m_get_engine_obj_field(struct lwm2m_engine_ob
 	return NULL;
 }
 
+struct lwm2m_engine_res *lwm2m_get_engine_res(struct lwm2m_engine_obj_inst *obj_inst, int res_id)
+{
+	int i;
+
+	if (!obj_inst || !obj_inst->resources) {
+		return NULL;
+	}
+
+	/* Resources are usually initialized in resource ID order without gaps */
+	if (res_id >= 0 && res_id < obj_inst->resource_count &&
+	    obj_inst->resources[res_id].res_id == res_id) {
+		return &obj_inst->resources[res_id];
+	}
+
+	for (i = 0; i < obj_inst->resource_count; i++) {
+		if (obj_inst->resources[i].res_id == res_id) {
+			return &obj_inst->resources[i];
+		}
+	}
+
+	return NULL;
+}
+
 struct lwm2m_engine_obj *lwm2m_engine_get_obj(const struct lwm2m_obj_path *path)
 {
 	if (path->level < LWM2M_PATH_LEVEL_OBJECT) {
@@ -141,6 +195,9 @@ static void engine_register_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif /* CONFIG_LWM2M_RD_CLIENT_SUPPORT_BOOTSTRAP */
 #endif /* CONFIG_LWM2M_ACCESS_CONTROL_ENABLE */
 	sys_slist_append(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_append(registry_bucket(engine_obj_inst_buckets, obj_inst->obj->obj_id,
+					 obj_inst->obj_inst_id),
+			 &obj_inst->hash_node);
 }
 
 static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
@@ -150,13 +207,21 @@ static void engine_unregister_obj_inst(struct lwm2m_engine_obj_inst *obj_inst)
 #endif
 	engine_remove_observer_by_id(obj_inst->obj->obj_id, obj_inst->obj_inst_id);
 	sys_slist_find_and_remove(&engine_obj_inst_list, &obj_inst->node);
+	sys_slist_find_and_remove(registry_bucket(engine_obj_inst_buckets, obj_inst->obj->obj_id,
+						  obj_inst->obj_inst_id),
+				  &obj_inst->hash_node);
 }
 
 struct lwm2m_engine_obj_inst *get_engine_obj_inst(int obj_id, int obj_inst_id)
 {
 	struct lwm2m_engine_obj_inst *obj_inst;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&engine_obj_inst_list, obj_inst, node) {
+	if (obj_id < 0 || obj_id > UINT16_MAX || obj_inst_id < 0 || obj_inst_id > UINT16_MAX) {
+		return NULL;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(registry_bucket(engine_obj_inst_buckets, obj_id, obj_inst_id),
+				     obj_inst, hash_node) {
 		if (obj_inst->obj->obj_id == obj_id && obj_inst->obj_inst_id == obj_inst_id) {
 			return obj_inst;
 		}
@@ -367,7 +432,7 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 {
 	struct lwm2m_engine_obj_inst *oi;
 	struct lwm2m_engine_obj_field *of;
-	struct lwm2m_engine_res *r = NULL;
+	struct lwm2m_engine_res *r;
 	struct lwm2m_engine_res_inst *ri = NULL;
 	int i;
 
@@ -392,13 +457,7 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < oi->resource_count; i++) {
-		if (oi->resources[i].res_id == path->res_id) {
-			r = &oi->resources[i];
-			break;
-		}
-	}
-
+	r = lwm2m_get_engine_res(oi, path->res_id);
 	if (!r) {
 		if (LWM2M_HAS_PERM(of, BIT(LWM2M_FLAG_OPTIONAL))) {
 			LOG_DBG("resource %d not found", path->res_id);
@@ -409,10 +468,15 @@ int path_to_objs(const struct lwm2m_obj_path *path, struct lwm2m_engine_obj_inst
 		return -ENOENT;
 	}
 
-	for (i = 0; i < r->res_inst_count; i++) {
-		if (r->res_instances[i].res_inst_id == path->res_inst_id) {
-			ri = &r->res_instances[i];
-			break;
+	if (path->res_inst_id < r->res_inst_count &&
+	    r->res_instances[path->res_inst_id].res_inst_id == path->res_inst_id) {
+		ri = &r->res_instances[path->res_inst_id];
+	} else {
+		for (i = 0; i < r->res_inst_count; i++) {
+			if (r->res_instances[i].res_inst_id == path->res_inst_id) {
+				ri = &r->res_instances[i];
+				break;
+			}
 		}
 	}
 
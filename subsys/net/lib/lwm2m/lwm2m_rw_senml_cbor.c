@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include <inttypes.h>
 #include <ctype.h>
 #include <time.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/kernel.h>
 
@@ -49,6 +50,12 @@ struct cbor_out_fmt_data {
 	/* Basetime for Cached data timestamp */
 	time_t basetime;
 
+	/* Number of records already encoded to the output buffer */
+	uint32_t record_total;
+
+	/* Offset of the first encoded record in the output buffer */
+	uint16_t payload_start;
+
 	/* Storage for object links */
 	struct {
 		char objlnk[CONFIG_LWM2M_RW_SENML_CBOR_RECORDS][sizeof("65535:65535")];
@@ -87,6 +94,8 @@ K_MUTEX_DEFINE(fd_mtx);
 /* Consume the current record */
 #define CONSUME_CBOR_FD_REC(fd) \
 	&((fd)->input._lwm2m_senml__record[(fd)->input._lwm2m_senml__record_count++])
+/* Largest array header needed for the number of records in a message */
+#define SENML_ARRAY_HDR_MAX_LEN 3
 /* Get CBOR output formatter data */
 #define LWM2M_OFD_CBOR(octx) ((struct cbor_out_fmt_data *)engine_get_out_user_data(octx))
 
@@ -175,6 +184,45 @@ static int put_basename(struct lwm2m_output_context *out, struct lwm2m_obj_path
 	return 0;
 }
 
+/* Encode the consumed record straight to the output buffer, so that the
+ * formatter only holds the record being built and the payload size is only
+ * limited by the output buffer. The SenML array header is written by
+ * put_end() once the number of records is known.
+ */
+static int flush_record(struct lwm2m_output_context *out)
+{
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+	uint8_t *ptr = CPKT_BUF_W_PTR(out->out_cpkt);
+	size_t len;
+	uint_fast8_t ret;
+
+	/* Single element array, the header of which is kept for the first
+	 * record as a placeholder for the final array header.
+	 */
+	ret = cbor_encode_lwm2m_senml(CPKT_BUF_W_REGION(out->out_cpkt), &fd->input, &len);
+	if (ret != ZCBOR_SUCCESS || len < 2) {
+		LOG_ERR("unable to encode senml cbor record");
+		return -ENOMEM;
+	}
+
+	if (fd->record_total == 0) {
+		fd->payload_start = out->out_cpkt->offset;
+	} else {
+		memmove(ptr, ptr + 1, --len);
+	}
+
+	out->out_cpkt->offset += len;
+	fd->record_total++;
+
+	/* Names and object links were only referenced by the encoded record */
+	(void)memset(&fd->input._lwm2m_senml__record[0], 0, sizeof(struct record));
+	fd->input._lwm2m_senml__record_count = 0;
+	fd->name_cnt = 0;
+	fd->objlnk_cnt = 0;
+
+	return 0;
+}
+
 static int put_empty_array(struct lwm2m_output_context *out)
 {
 	int len = 1;
@@ -187,27 +235,47 @@ static int put_empty_array(struct lwm2m_output_context *out)
 
 static int put_end(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
 {
+	struct cbor_out_fmt_data *fd = LWM2M_OFD_CBOR(out);
+	uint8_t hdr[SENML_ARRAY_HDR_MAX_LEN];
+	uint8_t *start;
+	size_t hdr_len;
 	size_t len;
-	struct lwm2m_senml *input = &(LWM2M_OFD_CBOR(out)->input);
 
-	if (!input->_lwm2m_senml__record_count) {
+	if (!fd->record_total) {
 		len = put_empty_array(out);
 
 		return len;
 	}
 
-	uint_fast8_t ret =
-		cbor_encode_lwm2m_senml(CPKT_BUF_W_REGION(out->out_cpkt), input, &len);
+	/* Definite length array header, as a canonical encoder writes it */
+	if (fd->record_total < 24) {
+		hdr[0] = 0x80 | fd->record_total;
+		hdr_len = 1;
+	} else if (fd->record_total <= UINT8_MAX) {
+		hdr[0] = 0x98;
+		hdr[1] = fd->record_total;
+		hdr_len = 2;
+	} else if (fd->record_total <= UINT16_MAX) {
+		hdr[0] = 0x99;
+		sys_put_be16(fd->record_total, &hdr[1]);
+		hdr_len = 3;
+	} else {
+		return -E2BIG;
+	}
 
-	if (ret != ZCBOR_SUCCESS) {
+	if (hdr_len - 1 > CPKT_BUF_W_SIZE(out->out_cpkt)) {
 		LOG_ERR("unable to encode senml cbor msg");
-
-		return -E2BIG;
+		return -ENOMEM;
 	}
 
-	out->out_cpkt->offset += len;
+	/* Replace the placeholder header of the first record */
+	start = out->out_cpkt->data + fd->payload_start;
+	len = out->out_cpkt->offset - fd->payload_start - 1;
+	memmove(start + hdr_len, start + 1, len);
+	memcpy(start, hdr, hdr_len);
+	out->out_cpkt->offset += hdr_len - 1;
 
-	return len;
+	return hdr_len + len;
 }
 
 static int put_begin_oi(struct lwm2m_output_context *out, struct lwm2m_obj_path *path)
@@ -376,7 +444,7 @@ static int put_value(struct lwm2m_output_context *out, struct lwm2m_obj_path *pa
 	record->_record_union._union_vi = value;
 	record->_record_union_present = 1;
 
-	return 0;
+	return flush_record(out);
 }
 
 static int put_s8(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, int8_t value)
@@ -414,7 +482,7 @@ static int put_time(struct lwm2m_output_context *out, struct lwm2m_obj_path *pat
 	record->_record_union._union_vi = (int64_t)value;
 	record->_record_union_present = 1;
 
-	return 0;
+	return flush_record(out);
 }
 
 static int put_float(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, double *value)
@@ -432,7 +500,7 @@ static int put_float(struct lwm2m_output_context *out, struct lwm2m_obj_path *pa
 	record->_record_union._union_vf = *value;
 	record->_record_union_present = 1;
 
-	return 0;
+	return flush_record(out);
 }
 
 static int put_string(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, char *buf,
@@ -452,7 +520,7 @@ static int put_string(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	record->_record_union._union_vs.len = buflen;
 	record->_record_union_present = 1;
 
-	return 0;
+	return flush_record(out);
 }
 
 static int put_bool(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, bool value)
@@ -470,7 +538,7 @@ static int put_bool(struct lwm2m_output_context *out, struct lwm2m_obj_path *pat
 	record->_record_union._union_vb = value;
 	record->_record_union_present = 1;
 
-	return 0;
+	return flush_record(out);
 }
 
 static int put_opaque(struct lwm2m_output_context *out, struct lwm2m_obj_path *path, char *buf,
@@ -490,7 +558,7 @@ static int put_opaque(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	record->_record_union._union_vd.len = buflen;
 	record->_record_union_present = 1;
 
-	return 0;
+	return flush_record(out);
 }
 
 static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *path,
@@ -529,7 +597,7 @@ static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 
 	fd->objlnk_cnt++;
 
-	return 0;
+	return flush_record(out);
 }
 
 static int get_opaque(struct lwm2m_input_context *in,
@@ -576,3 +576,15 @@ char *sprint_token(const uint8_t *token, uint8_t tkl)
 
 	return buf;
 }
+
+uint32_t lwm2m_token_hash(const uint8_t *token, uint8_t tkl)
+{
+	/* FNV-1a */
+	uint32_t hash = 2166136261U;
+
+	for (int i = 0; i < tkl; i++) {
+		hash = (hash ^ token[i]) * 16777619U;
+	}
+
+	return hash;
+}
@@ -45,4 +45,13 @@ char *lwm2m_sprint_ip_addr(const struct sockaddr *addr);
  */
 char *sprint_token(const uint8_t *token, uint8_t tkl);
 
+/**
+ * @brief Computes a hash of the token, for indexing by token.
+ *
+ * @param[in] token Token to be hashed
+ * @param[in] tkl Length of the token
+ * @return hash of the token
+ */
+uint32_t lwm2m_token_hash(const uint8_t *token, uint8_t tkl);
+
 #endif /* LWM2M_UTIL_H_ */
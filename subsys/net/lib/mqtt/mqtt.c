@@ -18,6 +18,9 @@ LOG_MODULE_REGISTER(net_mqtt, CONFIG_MQTT_LOG_LEVEL);
 #include "mqtt_internal.h"
 #include "mqtt_os.h"
 
+/* Maximum number of I/O vectors in one batched publish write. */
+#define MQTT_PUBLISH_BATCH_IOV 16
+
 static void client_reset(struct mqtt_client *client)
 {
 	MQTT_STATE_INIT(client);
@@ -27,10 +30,13 @@ static void client_reset(struct mqtt_client *client)
 	client->internal.remaining_payload = 0U;
 }
 
-/** @brief Initialize tx buffer. */
+/** @brief Initialize tx buffer.
+ *
+ * The encoders write every byte of the frame they produce, so the buffer
+ * does not need to be cleared for each packet.
+ */
 static void tx_buf_init(struct mqtt_client *client, struct buf_ctx *buf)
 {
-	memset(client->tx_buf, 0, client->tx_buf_size);
 	buf->cur = client->tx_buf;
 	buf->end = client->tx_buf + client->tx_buf_size;
 }
@@ -167,6 +173,184 @@ static int client_write_msg(struct mqtt_client *client,
 	return 0;
 }
 
+#if defined(CONFIG_MQTT_INFLIGHT_WINDOW)
+static struct mqtt_inflight *inflight_find(struct mqtt_client *client,
+					   uint16_t message_id)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight *entry = &client->internal.inflight[i];
+
+		if (entry->used && entry->param.message_id == message_id) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static struct mqtt_inflight *inflight_alloc(struct mqtt_client *client)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		if (!client->internal.inflight[i].used) {
+			return &client->internal.inflight[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Adds a QoS 1 or QoS 2 message to the window. On success, *added is set to
+ * the new entry, or to NULL if the message was not added by this call, so
+ * that it can be removed again if the message cannot be sent.
+ */
+static int inflight_add(struct mqtt_client *client,
+			const struct mqtt_publish_param *param,
+			struct mqtt_inflight **added)
+{
+	struct mqtt_inflight *entry;
+
+	*added = NULL;
+
+	if (param->message.topic.qos == MQTT_QOS_0_AT_MOST_ONCE) {
+		return 0;
+	}
+
+	entry = inflight_find(client, param->message_id);
+	if (entry == NULL) {
+		entry = inflight_alloc(client);
+		if (entry == NULL) {
+			return -EAGAIN;
+		}
+
+		*added = entry;
+	} else if (!param->dup_flag) {
+		NET_ERR("[CID %p]: Message id 0x%04x already in flight",
+			client, param->message_id);
+		return -EEXIST;
+	}
+
+	entry->param = *param;
+	entry->released = false;
+	entry->used = true;
+
+	return 0;
+}
+
+static void inflight_remove(struct mqtt_inflight *entry)
+{
+	if (entry != NULL) {
+		memset(entry, 0, sizeof(*entry));
+	}
+}
+
+void mqtt_inflight_clear(struct mqtt_client *client)
+{
+	memset(client->internal.inflight, 0, sizeof(client->internal.inflight));
+}
+
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id)
+{
+	struct mqtt_inflight *entry;
+
+	entry = inflight_find(client, message_id);
+	if (entry == NULL) {
+		return;
+	}
+
+	if (type == MQTT_PKT_TYPE_PUBREC) {
+		entry->released = true;
+		return;
+	}
+
+	inflight_remove(entry);
+}
+
+static int inflight_resend_one(struct mqtt_client *client,
+			       struct mqtt_inflight *entry)
+{
+	struct buf_ctx packet;
+	struct iovec io_vector[2];
+	struct msghdr msg;
+	int err_code;
+
+	tx_buf_init(client, &packet);
+
+	if (entry->released) {
+		const struct mqtt_pubrel_param param = {
+			.message_id = entry->param.message_id,
+		};
+
+		err_code = publish_release_encode(&param, &packet);
+		if (err_code < 0) {
+			return err_code;
+		}
+
+		return mqtt_transport_write(client, packet.cur,
+					    packet.end - packet.cur);
+	}
+
+	entry->param.dup_flag = 1U;
+
+	err_code = publish_encode(&entry->param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	io_vector[0].iov_base = packet.cur;
+	io_vector[0].iov_len = packet.end - packet.cur;
+	io_vector[1].iov_base = entry->param.message.payload.data;
+	io_vector[1].iov_len = entry->param.message.payload.len;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = ARRAY_SIZE(io_vector);
+
+	return mqtt_transport_write_msg(client, &msg);
+}
+
+int mqtt_inflight_resend(struct mqtt_client *client)
+{
+	int err_code;
+
+	for (int i = 0; i < ARRAY_SIZE(client->internal.inflight); i++) {
+		struct mqtt_inflight *entry = &client->internal.inflight[i];
+
+		if (!entry->used) {
+			continue;
+		}
+
+		NET_DBG("[CID %p]: Resending message id 0x%04x", client,
+			entry->param.message_id);
+
+		err_code = inflight_resend_one(client, entry);
+		if (err_code < 0) {
+			NET_ERR("[CID %p]: Resend failed, err_code = %d",
+				client, err_code);
+			return err_code;
+		}
+
+		client->internal.last_activity = mqtt_sys_tick_in_ms_get();
+	}
+
+	return 0;
+}
+#else
+static inline int inflight_add(struct mqtt_client *client,
+			       const struct mqtt_publish_param *param,
+			       struct mqtt_inflight **added)
+{
+	*added = NULL;
+
+	return 0;
+}
+
+static inline void inflight_remove(struct mqtt_inflight *entry)
+{
+}
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 void mqtt_client_init(struct mqtt_client *client)
 {
 	NULL_PARAM_CHECK_VOID(client);
@@ -215,6 +399,11 @@ int mqtt_connect(struct mqtt_client *client)
 		goto error;
 	}
 
+	/* A clean session drops the messages of the previous session. */
+	if (client->clean_session) {
+		mqtt_inflight_clear(client);
+	}
+
 	err_code = client_connect(client);
 
 error:
@@ -243,6 +432,7 @@ int mqtt_publish(struct mqtt_client *client,
 	struct buf_ctx packet;
 	struct iovec io_vector[2];
 	struct msghdr msg;
+	struct mqtt_inflight *added;
 
 	NULL_PARAM_CHECK(client);
 	NULL_PARAM_CHECK(param);
@@ -266,6 +456,11 @@ int mqtt_publish(struct mqtt_client *client,
 		goto error;
 	}
 
+	err_code = inflight_add(client, param, &added);
+	if (err_code < 0) {
+		goto error;
+	}
+
 	io_vector[0].iov_base = packet.cur;
 	io_vector[0].iov_len = packet.end - packet.cur;
 	io_vector[1].iov_base = param->message.payload.data;
@@ -277,6 +472,10 @@ int mqtt_publish(struct mqtt_client *client,
 	msg.msg_iovlen = ARRAY_SIZE(io_vector);
 
 	err_code = client_write_msg(client, &msg);
+	if (err_code < 0) {
+		/* The message was not sent, it is not in flight. */
+		inflight_remove(added);
+	}
 
 error:
 	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
@@ -287,6 +486,109 @@ error:
 	return err_code;
 }
 
+int mqtt_publish_batch(struct mqtt_client *client,
+		       const struct mqtt_publish_param *params, size_t count)
+{
+	struct iovec io_vector[MQTT_PUBLISH_BATCH_IOV];
+	/* A message without a payload takes a single vector. */
+	struct mqtt_inflight *added[MQTT_PUBLISH_BATCH_IOV];
+	struct buf_ctx packet;
+	struct msghdr msg;
+	size_t sent = 0;
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(params);
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> Message count %zu",
+		 client, client->internal.state, count);
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	while (sent < count && err_code == 0) {
+		size_t batch = 0;
+		size_t iovlen = 0;
+		int ret;
+
+		tx_buf_init(client, &packet);
+
+		/* Each message takes a header and a payload vector. */
+		while (sent + batch < count && batch < ARRAY_SIZE(added) &&
+		       iovlen + 2 <= ARRAY_SIZE(io_vector)) {
+			const struct mqtt_publish_param *param =
+							&params[sent + batch];
+
+			packet.end = client->tx_buf + client->tx_buf_size;
+
+			err_code = publish_encode(param, &packet);
+			if (err_code == -ENOMEM && batch > 0) {
+				/* TX buffer full, send what it holds. */
+				err_code = 0;
+				break;
+			}
+
+			if (err_code == 0) {
+				err_code = inflight_add(client, param,
+							&added[batch]);
+			}
+
+			if (err_code < 0) {
+				break;
+			}
+
+			io_vector[iovlen].iov_base = packet.cur;
+			io_vector[iovlen].iov_len = packet.end - packet.cur;
+			iovlen++;
+
+			if (param->message.payload.len > 0) {
+				io_vector[iovlen].iov_base =
+					param->message.payload.data;
+				io_vector[iovlen].iov_len =
+					param->message.payload.len;
+				iovlen++;
+			}
+
+			packet.cur = packet.end;
+			batch++;
+		}
+
+		if (batch == 0) {
+			break;
+		}
+
+		memset(&msg, 0, sizeof(msg));
+
+		msg.msg_iov = io_vector;
+		msg.msg_iovlen = iovlen;
+
+		ret = client_write_msg(client, &msg);
+		if (ret < 0) {
+			/* None of the messages of the write is in flight. */
+			for (size_t i = 0; i < batch; i++) {
+				inflight_remove(added[i]);
+			}
+
+			err_code = ret;
+			break;
+		}
+
+		sent += batch;
+	}
+
+error:
+	NET_DBG("[CID %p]:[State 0x%02x]: << sent %zu, result 0x%08x",
+		 client, client->internal.state, sent, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return (sent > 0) ? sent : err_code;
+}
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -401,7 +401,13 @@ int publish_encode(const struct mqtt_publish_param *param, struct buf_ctx *buf)
 		return -EINVAL;
 	}
 
-	/* Reserve space for fixed header. */
+	/* Reserve space for fixed header. The buffer may already hold
+	 * other messages of a batch, so check it's there.
+	 */
+	if ((buf->end - buf->cur) < MQTT_FIXED_HEADER_MAX_SIZE) {
+		return -ENOMEM;
+	}
+
 	buf->cur += MQTT_FIXED_HEADER_MAX_SIZE;
 	start = buf->cur;
 
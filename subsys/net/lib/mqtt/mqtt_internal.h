@@ -162,6 +162,46 @@ void event_notify(struct mqtt_client *client, const struct mqtt_evt *evt);
  */
 int mqtt_handle_rx(struct mqtt_client *client);
 
+#if defined(CONFIG_MQTT_INFLIGHT_WINDOW)
+/**@brief Updates the in-flight window on a publish acknowledgment.
+ *
+ * @param[in] client Identifies the client which received the packet.
+ * @param[in] type MQTT_PKT_TYPE_PUBACK, MQTT_PKT_TYPE_PUBREC or
+ *                 MQTT_PKT_TYPE_PUBCOMP.
+ * @param[in] message_id Message id of the acknowledged message.
+ */
+void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+		       uint16_t message_id);
+
+/**@brief Retransmits the in-flight messages after a reconnection.
+ *
+ * @param[in] client Identifies the client which got connected.
+ *
+ * @return 0 if the procedure is successful, an error code otherwise.
+ */
+int mqtt_inflight_resend(struct mqtt_client *client);
+
+/**@brief Drops the in-flight messages, when the broker has no session.
+ *
+ * @param[in] client Identifies the client which got connected.
+ */
+void mqtt_inflight_clear(struct mqtt_client *client);
+#else
+static inline void mqtt_inflight_ack(struct mqtt_client *client, uint8_t type,
+				     uint16_t message_id)
+{
+}
+
+static inline int mqtt_inflight_resend(struct mqtt_client *client)
+{
+	return 0;
+}
+
+static inline void mqtt_inflight_clear(struct mqtt_client *client)
+{
+}
+#endif /* CONFIG_MQTT_INFLIGHT_WINDOW */
+
 /**@brief Constructs/encodes Connect packet.
  *
  * @param[in] client Identifies the client for which the procedure is requested.
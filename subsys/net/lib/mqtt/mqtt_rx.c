@@ -42,6 +42,19 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 						MQTT_CONNECTION_ACCEPTED) {
 				/* Set state. */
 				MQTT_SET_STATE(client, MQTT_STATE_CONNECTED);
+
+				/* Messages in flight only exist in a session
+				 * the broker kept. MQTT 3.1 has no session
+				 * present flag, the session is kept unless a
+				 * clean one was requested.
+				 */
+				if (client->protocol_version == MQTT_VERSION_3_1_0 ?
+				    !client->clean_session :
+				    evt.param.connack.session_present_flag) {
+					err_code = mqtt_inflight_resend(client);
+				} else {
+					mqtt_inflight_clear(client);
+				}
 			} else {
 				err_code = -ECONNREFUSED;
 			}
@@ -77,6 +90,10 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBACK;
 		err_code = publish_ack_decode(buf, &evt.param.puback);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_ack(client, MQTT_PKT_TYPE_PUBACK,
+					  evt.param.puback.message_id);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_PUBREC:
@@ -85,6 +102,10 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBREC;
 		err_code = publish_receive_decode(buf, &evt.param.pubrec);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_ack(client, MQTT_PKT_TYPE_PUBREC,
+					  evt.param.pubrec.message_id);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_PUBREL:
@@ -101,6 +122,10 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBCOMP;
 		err_code = publish_complete_decode(buf, &evt.param.pubcomp);
 		evt.result = err_code;
+		if (err_code == 0) {
+			mqtt_inflight_ack(client, MQTT_PKT_TYPE_PUBCOMP,
+					  evt.param.pubcomp.message_id);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_SUBACK:
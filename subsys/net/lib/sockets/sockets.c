@@ -288,6 +288,9 @@ int z_impl_zsock_close(int sock)
 		return -1;
 	}
 
+	/* Let e.g. epoll forget the socket before it goes away */
+	z_fd_close_notify(sock);
+
 	(void)k_mutex_lock(lock, K_FOREVER);
 
 	NET_DBG("close: ctx=%p, fd=%d", ctx, sock);
@@ -1478,6 +1481,243 @@ ssize_t z_vrfy_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 #include <syscalls/zsock_recvfrom_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZEROCOPY)
+static struct net_context *zsock_zc_get_ctx(int sock, struct k_mutex **lock)
+{
+	const struct socket_op_vtable *vtable;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	/* Only native sockets keep received data in net_pkt fragments */
+	if (vtable != &sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return NULL;
+	}
+
+	return obj;
+}
+
+/* Fill the fragment views starting from the current packet cursor,
+ * returning the number of bytes covered.
+ */
+static size_t zsock_zc_fill_iov(struct net_pkt *pkt, struct zsock_zc_rx *rx)
+{
+	struct net_buf *frag = pkt->cursor.buf;
+	uint8_t *pos = pkt->cursor.pos;
+	size_t len = 0;
+
+	rx->iovcnt = 0;
+
+	while (frag != NULL && rx->iovcnt < rx->iovlen) {
+		size_t frag_len = frag->len - (pos - frag->data);
+
+		if (frag_len > 0) {
+			rx->iov[rx->iovcnt].iov_base = pos;
+			rx->iov[rx->iovcnt].iov_len = frag_len;
+			rx->iovcnt++;
+			len += frag_len;
+		}
+
+		frag = frag->frags;
+		if (frag != NULL) {
+			pos = frag->data;
+		}
+	}
+
+	return len;
+}
+
+static ssize_t zsock_recv_zc_ctx(struct net_context *ctx,
+				 struct zsock_zc_rx *rx, int flags)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t data_len;
+	uint64_t end;
+	size_t len;
+	int res;
+
+	if (rx->iov == NULL || rx->iovlen == 0 ||
+	    (flags & ~ZSOCK_MSG_DONTWAIT) != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (!net_context_is_used(ctx)) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (sock_type != SOCK_STREAM && sock_type != SOCK_DGRAM) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (sock_type == SOCK_STREAM &&
+	    net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+		errno = ENOTCONN;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else if (!sock_is_eof(ctx) && !sock_is_error(ctx)) {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+	}
+
+	end = sys_clock_timeout_end_calc(timeout);
+
+	do {
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			res = zsock_wait_data(ctx, &timeout);
+			if (res < 0) {
+				errno = -res;
+				return -1;
+			}
+		}
+
+		pkt = k_fifo_peek_head(&ctx->recv_q);
+		if (pkt == NULL) {
+			if (sock_is_error(ctx)) {
+				errno = POINTER_TO_INT(ctx->user_data);
+				return -1;
+			} else if (sock_is_eof(ctx)) {
+				return 0;
+			} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				errno = EAGAIN;
+				return -1;
+			}
+
+			/* Woken up without data, e.g. another thread took
+			 * it, so wait for the rest of the timeout.
+			 */
+			timeout_recalc(end, &timeout);
+			continue;
+		}
+
+		data_len = net_pkt_remaining_data(pkt);
+		len = zsock_zc_fill_iov(pkt, rx);
+
+		if (sock_type == SOCK_STREAM && len < data_len) {
+			/* Only part of the fragment chain fits, the loan takes
+			 * its own reference and the rest stays queued.
+			 */
+			net_pkt_ref(pkt);
+			net_pkt_skip(pkt, len);
+			break;
+		}
+
+		/* The whole packet is lent out, so the loan inherits the
+		 * reference held by the receive queue.
+		 */
+		k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+
+		if (sock_type == SOCK_STREAM && net_pkt_eof(pkt)) {
+			sock_set_eof(ctx);
+		}
+
+		if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS)) {
+			net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+		}
+
+		if (sock_type == SOCK_STREAM && len == 0) {
+			/* Nothing to lend, e.g. a bare EOF marker */
+			net_pkt_unref(pkt);
+			continue;
+		}
+
+		break;
+	} while (true);
+
+	rx->len = len;
+	rx->pkt = pkt;
+	rx->ctx = ctx;
+	rx->generation = ctx->generation;
+
+	return len;
+}
+
+ssize_t zsock_recv_zc(int sock, struct zsock_zc_rx *rx, int flags)
+{
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	if (rx == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ctx = zsock_zc_get_ctx(sock, &lock);
+	if (ctx == NULL) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = zsock_recv_zc_ctx(ctx, rx, flags);
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+int zsock_recv_zc_release(int sock, struct zsock_zc_rx *rx)
+{
+	const struct fd_op_vtable *vtable;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	int saved_errno = errno;
+
+	if (rx == NULL || rx->pkt == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	/* The loan holds its own packet reference, so it can be returned
+	 * even if the socket was closed in the meantime. Only reopen the
+	 * receive window if the socket is still the one it came from, and
+	 * its context was not reused for another one since. A closed
+	 * socket is not an error here, so the errno set by the lookup is
+	 * discarded.
+	 */
+	ctx = z_get_fd_obj_and_vtable(sock, &vtable, &lock);
+	errno = saved_errno;
+	if (ctx != NULL && ctx == rx->ctx && net_context_is_used(ctx) &&
+	    ctx->generation == rx->generation) {
+		(void)k_mutex_lock(lock, K_FOREVER);
+
+		if (net_context_get_type(ctx) == SOCK_STREAM) {
+			net_context_update_recv_wnd(ctx, rx->len);
+		}
+
+		k_mutex_unlock(lock);
+	}
+
+	net_pkt_unref(rx->pkt);
+
+	rx->pkt = NULL;
+	rx->ctx = NULL;
+	rx->iovcnt = 0;
+	rx->len = 0;
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZEROCOPY */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
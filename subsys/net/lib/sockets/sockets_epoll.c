@@ -0,0 +1,761 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Persistent socket event sets.
+ *
+ * Every registered socket is kept armed with a k_work_poll watching the
+ * kernel objects the socket implementation exposes through
+ * ZFD_IOCTL_POLL_PREPARE. When one of them is signalled, the item is moved
+ * to the ready list of its set and the waiter is woken up. A waiter only
+ * inspects items on the ready list; items found not to be ready anymore are
+ * re-armed, ready ones stay on the list (level-triggered semantics).
+ *
+ * Offloaded sockets cannot be watched that way. They stay on the ready list
+ * and are polled through ZFD_IOCTL_POLL_OFFLOAD at most every
+ * CONFIG_NET_SOCKETS_EPOLL_OFFLOAD_POLL_INTERVAL milliseconds while a waiter
+ * sleeps. Their implementation may report readiness changes with
+ * zsock_epoll_notify() to wake up the waiter immediately.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/syscall_handler.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_epoll.h>
+
+#include "sockets_internal.h"
+
+/* Native sockets use up to two poll events, TLS may add one more */
+#define EPOLL_EVENTS_PER_FD 3
+
+/* Events reported even if not requested */
+#define EPOLL_ALWAYS_EVENTS (ZSOCK_POLLERR | ZSOCK_POLLHUP | ZSOCK_POLLNVAL)
+
+#define EPOLL_OFFLOAD_BUCKETS 8
+
+struct epoll_item {
+	/** Node in the registered item list of the set */
+	sys_dnode_t node;
+	/** Node in the ready list of the set */
+	sys_dnode_t ready_node;
+	/** Node in the offloaded object hash */
+	sys_snode_t offload_node;
+	struct k_work_poll work;
+	struct k_poll_event poll_events[EPOLL_EVENTS_PER_FD];
+	struct epoll_ctx *ep;
+	void *obj;
+	struct zsock_epoll_event event;
+	int fd;
+	bool offloaded;
+};
+
+__net_socket struct epoll_ctx {
+	/** Registered items, protected by lock */
+	sys_dlist_t items;
+	/** Items that may be ready, protected by ready_lock */
+	sys_dlist_t ready;
+	struct k_spinlock ready_lock;
+	struct k_mutex lock;
+	/** Given whenever an item is added to the ready list */
+	struct k_sem wake;
+	bool in_use;
+};
+
+static struct epoll_ctx epoll_contexts[CONFIG_NET_SOCKETS_EPOLL_MAX_INSTANCES];
+
+K_MEM_SLAB_DEFINE_STATIC(epoll_item_slab, sizeof(struct epoll_item),
+			 CONFIG_NET_SOCKETS_EPOLL_MAX_FDS, sizeof(void *));
+
+static sys_slist_t epoll_offload_items[EPOLL_OFFLOAD_BUCKETS];
+static K_MUTEX_DEFINE(epoll_offload_lock);
+static K_MUTEX_DEFINE(epoll_contexts_lock);
+
+static const struct socket_op_vtable epoll_fd_op_vtable;
+
+static sys_slist_t *epoll_offload_bucket(void *obj)
+{
+	return &epoll_offload_items[(POINTER_TO_UINT(obj) / sizeof(void *)) %
+				    EPOLL_OFFLOAD_BUCKETS];
+}
+
+static void epoll_item_queue(struct epoll_item *item, bool wake)
+{
+	struct epoll_ctx *ep = item->ep;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ep->ready_lock);
+
+	if (!sys_dnode_is_linked(&item->ready_node)) {
+		sys_dlist_append(&ep->ready, &item->ready_node);
+	}
+
+	k_spin_unlock(&ep->ready_lock, key);
+
+	if (wake) {
+		k_sem_give(&ep->wake);
+	}
+}
+
+static void epoll_item_set_ready(struct epoll_item *item)
+{
+	epoll_item_queue(item, true);
+}
+
+static void epoll_item_triggered(struct k_work *work)
+{
+	struct k_work_poll *pwork = CONTAINER_OF(work, struct k_work_poll, work);
+	struct epoll_item *item = CONTAINER_OF(pwork, struct epoll_item, work);
+
+	epoll_item_set_ready(item);
+}
+
+/* Make sure the item is neither armed, nor queued, nor on the ready list. */
+static void epoll_item_disarm(struct epoll_item *item)
+{
+	struct epoll_ctx *ep = item->ep;
+	struct k_work_sync sync;
+	k_spinlock_key_t key;
+
+	(void)k_work_poll_cancel(&item->work);
+	(void)k_work_cancel_sync(&item->work.work, &sync);
+
+	/* Cancelling a queued work leaves it owned by the work queue,
+	 * so start over with a clean one.
+	 */
+	k_work_poll_init(&item->work, epoll_item_triggered);
+
+	key = k_spin_lock(&ep->ready_lock);
+
+	if (sys_dnode_is_linked(&item->ready_node)) {
+		sys_dlist_remove(&item->ready_node);
+	}
+
+	k_spin_unlock(&ep->ready_lock, key);
+
+	if (item->offloaded) {
+		(void)k_mutex_lock(&epoll_offload_lock, K_FOREVER);
+		(void)sys_slist_find_and_remove(epoll_offload_bucket(item->obj),
+						&item->offload_node);
+		k_mutex_unlock(&epoll_offload_lock);
+
+		item->offloaded = false;
+	}
+}
+
+static void *epoll_item_get_obj(struct epoll_item *item,
+				const struct fd_op_vtable **vtable,
+				struct k_mutex **lock)
+{
+	void *obj;
+
+	obj = z_get_fd_obj_and_vtable(item->fd, vtable, lock);
+	if (obj != item->obj) {
+		/* Descriptor was closed behind our back */
+		return NULL;
+	}
+
+	return obj;
+}
+
+/* Start watching the item for readiness. Whenever the socket implementation
+ * cannot provide something to wait for, the item goes to the ready list and
+ * the next collect checks it.
+ */
+static int epoll_item_arm(struct epoll_item *item)
+{
+	struct zsock_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events,
+	};
+	struct k_poll_event *pev = item->poll_events;
+	struct k_poll_event *pev_end = pev + ARRAY_SIZE(item->poll_events);
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = epoll_item_get_obj(item, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_PREPARE,
+				   &pfd, &pev, pev_end);
+	k_mutex_unlock(lock);
+
+	if (ret == -EXDEV) {
+		if (!item->offloaded) {
+			(void)k_mutex_lock(&epoll_offload_lock, K_FOREVER);
+			sys_slist_append(epoll_offload_bucket(obj),
+					 &item->offload_node);
+			k_mutex_unlock(&epoll_offload_lock);
+
+			item->offloaded = true;
+		}
+
+		epoll_item_set_ready(item);
+
+		return 0;
+	}
+
+	if (ret == -EALREADY) {
+		epoll_item_set_ready(item);
+
+		return 0;
+	}
+
+	if (ret < 0) {
+		/* Descriptor does not support polling */
+		return -EPERM;
+	}
+
+	if (pev == item->poll_events) {
+		/* Nothing to wait for */
+		return 0;
+	}
+
+	return k_work_poll_submit(&item->work, item->poll_events,
+				  pev - item->poll_events, K_FOREVER);
+}
+
+/* Query the current readiness of an item, in the same way zsock_poll()
+ * does, but without waiting.
+ */
+static uint32_t epoll_item_check(struct epoll_item *item)
+{
+	struct zsock_pollfd pfd = {
+		.fd = item->fd,
+		.events = item->event.events,
+	};
+	struct k_poll_event events[EPOLL_EVENTS_PER_FD];
+	struct k_poll_event *pev = events;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = epoll_item_get_obj(item, &vtable, &lock);
+	if (obj == NULL) {
+		return ZSOCK_POLLNVAL;
+	}
+
+	if (item->offloaded) {
+		ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_OFFLOAD,
+					   &pfd, 1, 0);
+		if (ret < 0) {
+			return ZSOCK_POLLERR;
+		}
+
+		return pfd.revents;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_PREPARE,
+				   &pfd, &pev, events + ARRAY_SIZE(events));
+	k_mutex_unlock(lock);
+
+	if (ret < 0 && ret != -EALREADY) {
+		return ZSOCK_POLLERR;
+	}
+
+	(void)k_poll(events, pev - events, K_NO_WAIT);
+
+	pev = events;
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	ret = z_fdtable_call_ioctl(vtable, obj, ZFD_IOCTL_POLL_UPDATE,
+				   &pfd, &pev);
+	k_mutex_unlock(lock);
+
+	if (ret == -EAGAIN) {
+		/* Socket layer needs more data to decide, e.g. TLS */
+		return 0;
+	} else if (ret < 0) {
+		return ZSOCK_POLLERR;
+	}
+
+	return pfd.revents;
+}
+
+static void epoll_item_free(struct epoll_item *item)
+{
+	epoll_item_disarm(item);
+	sys_dlist_remove(&item->node);
+	k_mem_slab_free(&epoll_item_slab, (void **)&item);
+}
+
+static struct epoll_item *epoll_item_find(struct epoll_ctx *ep, int sock)
+{
+	struct epoll_item *item;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&ep->items, item, node) {
+		if (item->fd == sock) {
+			return item;
+		}
+	}
+
+	return NULL;
+}
+
+/* Go through the ready list, must be called with the set lock held.
+ * @a poll_offloaded is set if offloaded items not ready yet were left on
+ * the ready list, to be polled again later.
+ */
+static int epoll_collect(struct epoll_ctx *ep,
+			 struct zsock_epoll_event *events, int maxevents,
+			 bool *poll_offloaded)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+	k_spinlock_key_t key;
+	int count = 0;
+
+	sys_dlist_init(&pending);
+	*poll_offloaded = false;
+
+	/* Reset before draining, so that an item becoming ready from now on
+	 * is not missed by the next wait.
+	 */
+	k_sem_reset(&ep->wake);
+
+	key = k_spin_lock(&ep->ready_lock);
+
+	while ((node = sys_dlist_get(&ep->ready)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	k_spin_unlock(&ep->ready_lock, key);
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		struct epoll_item *item =
+			CONTAINER_OF(node, struct epoll_item, ready_node);
+		uint32_t revents;
+
+		if (count == maxevents) {
+			/* Leave the rest for the next call */
+			epoll_item_set_ready(item);
+			continue;
+		}
+
+		revents = epoll_item_check(item) &
+			  (item->event.events | EPOLL_ALWAYS_EVENTS);
+		if (revents == 0 && item->offloaded) {
+			/* Nothing to arm, keep polling it */
+			epoll_item_queue(item, false);
+			*poll_offloaded = true;
+			continue;
+		}
+
+		if (revents == 0) {
+			if (epoll_item_arm(item) < 0) {
+				revents = ZSOCK_POLLNVAL;
+			}
+		}
+
+		if (revents != 0) {
+			events[count].events = revents;
+			events[count].data = item->event.data;
+			count++;
+
+			/* Level-triggered, so check it again on next call,
+			 * unless the descriptor is gone.
+			 */
+			if (!(revents & ZSOCK_POLLNVAL)) {
+				epoll_item_set_ready(item);
+			}
+		}
+	}
+
+	return count;
+}
+
+static void epoll_timeout_recalc(uint64_t end, k_timeout_t *timeout)
+{
+	if (!K_TIMEOUT_EQ(*timeout, K_NO_WAIT) &&
+	    !K_TIMEOUT_EQ(*timeout, K_FOREVER)) {
+		int64_t remaining = end - sys_clock_tick_get();
+
+		if (remaining <= 0) {
+			*timeout = K_NO_WAIT;
+		} else {
+			*timeout = Z_TIMEOUT_TICKS(remaining);
+		}
+	}
+}
+
+/* Limit a wait, so that offloaded items are polled again in time */
+static void epoll_offload_timeout(k_timeout_t *timeout)
+{
+	k_timeout_t interval =
+		K_MSEC(CONFIG_NET_SOCKETS_EPOLL_OFFLOAD_POLL_INTERVAL);
+
+	if (K_TIMEOUT_EQ(*timeout, K_FOREVER) ||
+	    timeout->ticks > interval.ticks) {
+		*timeout = interval;
+	}
+}
+
+static struct epoll_ctx *epoll_get_ctx(int epfd)
+{
+	return z_get_fd_obj(epfd,
+			    (const struct fd_op_vtable *)&epoll_fd_op_vtable,
+			    EBADF);
+}
+
+int z_impl_zsock_epoll_create(void)
+{
+	struct epoll_ctx *ep = NULL;
+	int fd;
+
+	fd = z_reserve_fd();
+	if (fd < 0) {
+		return -1;
+	}
+
+	(void)k_mutex_lock(&epoll_contexts_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(epoll_contexts); i++) {
+		if (!epoll_contexts[i].in_use) {
+			ep = &epoll_contexts[i];
+			ep->in_use = true;
+			break;
+		}
+	}
+
+	k_mutex_unlock(&epoll_contexts_lock);
+
+	if (ep == NULL) {
+		z_free_fd(fd);
+		errno = ENOMEM;
+		return -1;
+	}
+
+	sys_dlist_init(&ep->items);
+	sys_dlist_init(&ep->ready);
+	k_mutex_init(&ep->lock);
+	k_sem_init(&ep->wake, 0, 1);
+
+	z_finalize_fd(fd, ep, (const struct fd_op_vtable *)&epoll_fd_op_vtable);
+
+	NET_DBG("epoll: ctx=%p, fd=%d", ep, fd);
+
+	return fd;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_create(void)
+{
+	return z_impl_zsock_epoll_create();
+}
+#include <syscalls/zsock_epoll_create_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+static int epoll_ctl_add(struct epoll_ctx *ep, int sock,
+			 const struct zsock_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	struct epoll_item *item;
+	void *obj;
+	int ret;
+
+	obj = z_get_fd_obj_and_vtable(sock, &vtable, NULL);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	if (obj == ep) {
+		return -EINVAL;
+	}
+
+	if (epoll_item_find(ep, sock) != NULL) {
+		return -EEXIST;
+	}
+
+	if (k_mem_slab_alloc(&epoll_item_slab, (void **)&item, K_NO_WAIT) < 0) {
+		return -ENOMEM;
+	}
+
+	*item = (struct epoll_item) {
+		.ep = ep,
+		.obj = obj,
+		.fd = sock,
+		.event = *event,
+	};
+
+	k_work_poll_init(&item->work, epoll_item_triggered);
+	sys_dlist_append(&ep->items, &item->node);
+
+	ret = epoll_item_arm(item);
+	if (ret < 0) {
+		epoll_item_free(item);
+	}
+
+	return ret;
+}
+
+int z_impl_zsock_epoll_ctl(int epfd, int op, int sock,
+			   struct zsock_epoll_event *event)
+{
+	struct epoll_ctx *ep;
+	struct epoll_item *item;
+	int ret = 0;
+
+	ep = epoll_get_ctx(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL && event == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		ret = epoll_ctl_add(ep, sock, event);
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		item = epoll_item_find(ep, sock);
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_disarm(item);
+		item->event = *event;
+
+		ret = epoll_item_arm(item);
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		item = epoll_item_find(ep, sock);
+		if (item == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_item_free(item);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_ctl(int epfd, int op, int sock,
+					 struct zsock_epoll_event *event)
+{
+	struct zsock_epoll_event event_copy;
+	struct epoll_ctx *ep;
+
+	ep = epoll_get_ctx(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	Z_OOPS(Z_SYSCALL_OBJ(ep, K_OBJ_NET_SOCKET));
+
+	if (event != NULL) {
+		Z_OOPS(z_user_from_copy(&event_copy, event,
+					sizeof(event_copy)));
+	}
+
+	return z_impl_zsock_epoll_ctl(epfd, op, sock,
+				      event != NULL ? &event_copy : NULL);
+}
+#include <syscalls/zsock_epoll_ctl_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			    int maxevents, int timeout)
+{
+	struct epoll_ctx *ep;
+	k_timeout_t wait_timeout;
+	k_timeout_t sleep_timeout;
+	bool poll_offloaded;
+	uint64_t end;
+	int count;
+
+	ep = epoll_get_ctx(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (events == NULL || maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout < 0) {
+		wait_timeout = K_FOREVER;
+	} else {
+		wait_timeout = K_MSEC(timeout);
+	}
+
+	end = sys_clock_timeout_end_calc(wait_timeout);
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	while (true) {
+		count = epoll_collect(ep, events, maxevents, &poll_offloaded);
+		if (count > 0 || K_TIMEOUT_EQ(wait_timeout, K_NO_WAIT)) {
+			break;
+		}
+
+		sleep_timeout = wait_timeout;
+		if (poll_offloaded) {
+			epoll_offload_timeout(&sleep_timeout);
+		}
+
+		/* Do not block ctl operations while sleeping */
+		k_mutex_unlock(&ep->lock);
+
+		(void)k_sem_take(&ep->wake, sleep_timeout);
+		epoll_timeout_recalc(end, &wait_timeout);
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	return count;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_wait(int epfd,
+					  struct zsock_epoll_event *events,
+					  int maxevents, int timeout)
+{
+	struct epoll_ctx *ep;
+
+	ep = epoll_get_ctx(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	Z_OOPS(Z_SYSCALL_OBJ(ep, K_OBJ_NET_SOCKET));
+
+	if (maxevents > 0) {
+		Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(events, maxevents,
+						    sizeof(*events)));
+	}
+
+	return z_impl_zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+#include <syscalls/zsock_epoll_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+void zsock_epoll_notify(void *obj)
+{
+	struct epoll_item *item;
+
+	(void)k_mutex_lock(&epoll_offload_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(epoll_offload_bucket(obj), item,
+				     offload_node) {
+		if (item->obj == obj) {
+			epoll_item_set_ready(item);
+		}
+	}
+
+	k_mutex_unlock(&epoll_offload_lock);
+}
+
+/* Remove a descriptor being closed from all event sets */
+static void epoll_fd_close(int sock)
+{
+	(void)k_mutex_lock(&epoll_contexts_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(epoll_contexts); i++) {
+		struct epoll_ctx *ep = &epoll_contexts[i];
+		struct epoll_item *item;
+
+		if (!ep->in_use) {
+			continue;
+		}
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		item = epoll_item_find(ep, sock);
+		if (item != NULL) {
+			epoll_item_free(item);
+		}
+
+		k_mutex_unlock(&ep->lock);
+	}
+
+	k_mutex_unlock(&epoll_contexts_lock);
+}
+
+static int epoll_close_vmeth(void *obj)
+{
+	struct epoll_ctx *ep = obj;
+	struct epoll_item *item, *next;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&ep->items, item, next, node) {
+		epoll_item_free(item);
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	(void)k_mutex_lock(&epoll_contexts_lock, K_FOREVER);
+	ep->in_use = false;
+	k_mutex_unlock(&epoll_contexts_lock);
+
+	return 0;
+}
+
+static int epoll_ioctl_vmeth(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct socket_op_vtable epoll_fd_op_vtable = {
+	.fd_vtable = {
+		.close = epoll_close_vmeth,
+		.ioctl = epoll_ioctl_vmeth,
+	},
+};
+
+static struct fd_close_notifier epoll_close_notifier = {
+	.cb = epoll_fd_close,
+};
+
+static int epoll_init(void)
+{
+	z_fd_close_notifier_register(&epoll_close_notifier);
+
+	return 0;
+}
+
+SYS_INIT(epoll_init, APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -270,6 +270,105 @@ static int cmd_kernel_heap(const struct shell *sh,
 }
 #endif
 
+#if defined(CONFIG_SCHED_LATENCY_STATS) && defined(CONFIG_THREAD_MONITOR)
+static void shell_sched_latency_dump(const struct shell *sh,
+				     const struct k_sched_latency_stats *stats)
+{
+	shell_print(sh, "\twakeups: %u, max latency: %u us, "
+		    "ready: %u us, preemptions: %u",
+		    stats->wakeups, k_cyc_to_us_ceil32(stats->max_latency),
+		    (uint32_t)k_cyc_to_us_ceil64(stats->ready_cycles),
+		    stats->preemptions);
+
+	for (int i = 0; i < ARRAY_SIZE(stats->histogram); i++) {
+		if (stats->histogram[i] == 0U) {
+			continue;
+		}
+
+		/* Bucket i holds latencies of at least 2^(i-1) cycles */
+		shell_print(sh, "\t>= %10u cycles: %u",
+			    (i == 0) ? 0U : (uint32_t)BIT64(i - 1),
+			    stats->histogram[i]);
+	}
+}
+
+static void shell_sched_thread_dump(const struct k_thread *cthread,
+				    void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	struct k_sched_latency_stats stats;
+	const char *tname;
+
+	if (k_thread_sched_latency_get(thread, &stats) != 0) {
+		return;
+	}
+
+	tname = k_thread_name_get(thread);
+
+	shell_print(sh, "%p %-" STRINGIFY(THREAD_MAX_NAM_LEN) "s prio %d",
+		    thread, tname ? tname : "NA", thread->base.prio);
+	shell_sched_latency_dump(sh, &stats);
+}
+
+static int cmd_kernel_sched(const struct shell *sh,
+			    size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+	struct k_sched_latency_stats stats;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus; i++) {
+		if (k_cpu_sched_latency_get(i, &stats) == 0) {
+			shell_print(sh, "CPU %d", i);
+			shell_sched_latency_dump(sh, &stats);
+		}
+	}
+
+#ifdef CONFIG_SMP
+	k_thread_foreach_unlocked(shell_sched_thread_dump, (void *)sh);
+#else
+	k_thread_foreach(shell_sched_thread_dump, (void *)sh);
+#endif
+	return 0;
+}
+
+static void shell_sched_thread_reset(const struct k_thread *thread,
+				     void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	(void)k_thread_sched_latency_reset((struct k_thread *)thread);
+}
+
+static int cmd_kernel_sched_reset(const struct shell *sh,
+				  size_t argc, char **argv)
+{
+	ARG_UNUSED(sh);
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (int i = 0; i < num_cpus; i++) {
+		(void)k_cpu_sched_latency_reset(i);
+	}
+
+#ifdef CONFIG_SMP
+	k_thread_foreach_unlocked(shell_sched_thread_reset, NULL);
+#else
+	k_thread_foreach(shell_sched_thread_reset, NULL);
+#endif
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_sched,
+	SHELL_CMD(reset, NULL, "Reset scheduling latency statistics.",
+		  cmd_kernel_sched_reset),
+	SHELL_SUBCMD_SET_END /* Array terminated. */
+);
+#endif
+
 static int cmd_kernel_sleep(const struct shell *sh,
 			    size_t argc, char **argv)
 {
@@ -370,6 +469,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 #endif
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 	SHELL_CMD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap),
+#endif
+#if defined(CONFIG_SCHED_LATENCY_STATS) && defined(CONFIG_THREAD_MONITOR)
+	SHELL_CMD(sched, &sub_kernel_sched, "Scheduling latency statistics.",
+		  cmd_kernel_sched),
 #endif
 	SHELL_CMD(uptime, NULL, "Kernel uptime.", cmd_kernel_uptime),
 	SHELL_CMD(version, NULL, "Kernel version.", cmd_kernel_version),
@@ -159,4 +159,51 @@ ZTEST(lib_mem_slab_stats_test, test_mem_slab_runtime_stats)
 		      2 * BLK_SZ, stats.max_allocated_bytes);
 }
 
+#ifdef CONFIG_MEM_SLAB_MAGAZINE
+K_MEM_SLAB_DEFINE(mag_slab, BLK_SZ, NUM_BLOCKS, 4);
+
+ZTEST(lib_mem_slab_stats_test, test_mem_slab_magazine_stats)
+{
+	struct sys_memory_stats  stats;
+	int   status;
+	void *memory[3];
+
+	status = k_mem_slab_runtime_stats_get(&mag_slab, &stats);
+	zassert_equal(status, 0, "Routine failed with status %d\n", status);
+	zassert_equal(stats.magazine_hits, 0, "Expected no magazine hits");
+	zassert_equal(stats.magazine_misses, 0, "Expected no magazine misses");
+
+	/*
+	 * The first allocation finds the magazine empty and refills it
+	 * under the slab lock, the next ones are served by the magazine.
+	 */
+
+	for (int i = 0; i < ARRAY_SIZE(memory); i++) {
+		status = k_mem_slab_alloc(&mag_slab, &memory[i], K_NO_WAIT);
+		zassert_equal(status, 0, "Routine failed to allocate block %d (%d)\n",
+			      i, status);
+	}
+
+	status = k_mem_slab_runtime_stats_get(&mag_slab, &stats);
+	zassert_equal(status, 0, "Routine failed with status %d\n", status);
+
+	zassert_equal(stats.magazine_hits, 2,
+		      "Expected 2 magazine hits, not %u\n", stats.magazine_hits);
+	zassert_equal(stats.magazine_misses, 1,
+		      "Expected 1 magazine miss, not %u\n", stats.magazine_misses);
+	zassert_equal(stats.allocated_bytes, 3 * BLK_SZ,
+		      "Expected %zu allocated bytes, not %zu\n",
+		      3 * BLK_SZ, stats.allocated_bytes);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	zassert_equal(stats.max_allocated_bytes, 3 * BLK_SZ,
+		      "Expected %zu max allocated bytes, not %zu\n",
+		      3 * BLK_SZ, stats.max_allocated_bytes);
+#endif
+
+	for (int i = 0; i < ARRAY_SIZE(memory); i++) {
+		k_mem_slab_free(&mag_slab, &memory[i]);
+	}
+}
+#endif
+
 ZTEST_SUITE(lib_mem_slab_stats_test, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 8
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern struct k_msgq msgq;
+static ZTEST_BMEM char __aligned(4) bbuffer[MSG_SIZE * BATCH_LEN];
+static ZTEST_DMEM uint32_t in[BATCH_LEN + 2];
+static ZTEST_DMEM uint32_t out[BATCH_LEN + 2];
+static ZTEST_BMEM int thread_ret;
+
+static void batch_put_get(struct k_msgq *q)
+{
+	for (int i = 0; i < ARRAY_SIZE(in); i++) {
+		in[i] = MSG0 + i;
+	}
+
+	zassert_equal(k_msgq_put_many(q, in, 0, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_many(q, out, 0, K_NO_WAIT), 0);
+
+	/**TESTPOINT: only the messages that fit are sent */
+	zassert_equal(k_msgq_put_many(q, in, ARRAY_SIZE(in), K_NO_WAIT),
+		      BATCH_LEN);
+	zassert_equal(k_msgq_num_used_get(q), BATCH_LEN);
+	zassert_equal(k_msgq_put_many(q, in, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_many(q, in, 1, TIMEOUT), -EAGAIN);
+
+	/**TESTPOINT: messages are received in order, across the wrap */
+	zassert_equal(k_msgq_get_many(q, out, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_put_many(q, in, 2, K_NO_WAIT), 2);
+	zassert_equal(k_msgq_get_many(q, out + 3, ARRAY_SIZE(out) - 3,
+				      K_NO_WAIT), BATCH_LEN - 1);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(out[i], in[i]);
+	}
+	zassert_equal(out[BATCH_LEN], in[0]);
+	zassert_equal(out[BATCH_LEN + 1], in[1]);
+
+	zassert_equal(k_msgq_get_many(q, out, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_many(q, out, 1, TIMEOUT), -EAGAIN);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test sending and receiving several messages at once
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api, test_msgq_put_get_many)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	batch_put_get(&msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test sending and receiving several messages at once from user mode
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_put_get_many)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN));
+
+	batch_put_get(q);
+}
+#endif
+
+static void get_many_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_msgq_get_many(p1, out, BATCH_LEN, K_FOREVER);
+}
+
+static void put_many_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_msgq_put_many(p1, in, 3, K_FOREVER);
+}
+
+/**
+ * @brief Test that waiting readers and writers move a whole batch
+ *
+ * @details A reader waiting on an empty queue gets the first message of a
+ * batch directly and then takes the rest from the queue. A writer waiting
+ * on a full queue gets its first message into the slot a batch read frees
+ * and then adds the rest.
+ *
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_many_pending)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	for (int i = 0; i < ARRAY_SIZE(in); i++) {
+		in[i] = MSG1 + i;
+	}
+
+	k_thread_create(&tdata, tstack, STACK_SIZE, get_many_entry, &msgq,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: a waiting reader gets the whole batch */
+	zassert_equal(k_msgq_put_many(&msgq, in, 4, K_NO_WAIT), 4);
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(thread_ret, 4);
+	for (int i = 0; i < 4; i++) {
+		zassert_equal(out[i], in[i]);
+	}
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+
+	zassert_equal(k_msgq_put_many(&msgq, in, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+	k_thread_create(&tdata, tstack, STACK_SIZE, put_many_entry, &msgq,
+			NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: a waiting writer gets its whole batch in */
+	zassert_equal(k_msgq_get_many(&msgq, out, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+	k_thread_join(&tdata, K_FOREVER);
+	zassert_equal(thread_ret, 3);
+	zassert_equal(k_msgq_get_many(&msgq, out, BATCH_LEN, K_NO_WAIT), 3);
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(out[i], in[i]);
+	}
+}
+
+/**
+ * @}
+ */
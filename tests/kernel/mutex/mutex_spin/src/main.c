@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define OWNER_PRIORITY K_PRIO_PREEMPT(1)
+
+/* Well below and well above CONFIG_MUTEX_ADAPTIVE_SPIN_US */
+#define SHORT_HOLD_US (CONFIG_MUTEX_ADAPTIVE_SPIN_US / 10)
+#define LONG_HOLD_US (CONFIG_MUTEX_ADAPTIVE_SPIN_US * 5)
+
+/* Longer than the spinning, but shorter than a long hold */
+#define TIMEOUT_US (CONFIG_MUTEX_ADAPTIVE_SPIN_US * 2)
+
+enum hold_mode {
+	HOLD_SHORT,
+	HOLD_LONG,
+	HOLD_SLEEPING,
+};
+
+static K_THREAD_STACK_DEFINE(owner_stack, STACK_SIZE);
+static struct k_thread owner_thread;
+static K_MUTEX_DEFINE(mutex);
+static atomic_t locked;
+
+static void owner_entry(void *p1, void *p2, void *p3)
+{
+	enum hold_mode mode = POINTER_TO_INT(p1);
+
+	zassert_ok(k_mutex_lock(&mutex, K_FOREVER));
+	atomic_set(&locked, 1);
+
+	switch (mode) {
+	case HOLD_SHORT:
+		k_busy_wait(SHORT_HOLD_US);
+		break;
+	case HOLD_LONG:
+		k_busy_wait(LONG_HOLD_US);
+		break;
+	case HOLD_SLEEPING:
+		k_sleep(K_USEC(LONG_HOLD_US));
+		break;
+	}
+
+	zassert_ok(k_mutex_unlock(&mutex));
+}
+
+/* Start a thread on another CPU holding the mutex */
+static k_tid_t start_owner(enum hold_mode mode)
+{
+	k_tid_t tid;
+
+	if (arch_num_cpus() < 2) {
+		ztest_test_skip();
+	}
+
+	atomic_clear(&locked);
+	zassert_ok(k_mutex_spin_stats_reset(&mutex));
+
+	tid = k_thread_create(&owner_thread, owner_stack, STACK_SIZE,
+			      owner_entry, INT_TO_POINTER(mode), NULL, NULL,
+			      OWNER_PRIORITY, 0, K_NO_WAIT);
+
+	/* Wait without pending, so the owner runs on the other CPU */
+	while (!atomic_get(&locked)) {
+		arch_spin_relax();
+	}
+
+	return tid;
+}
+
+/* Lock the mutex while a thread on another CPU holds it */
+static void contend(enum hold_mode mode, struct k_mutex_spin_stats *stats)
+{
+	k_tid_t tid = start_owner(mode);
+
+	zassert_ok(k_mutex_lock(&mutex, K_FOREVER));
+	zassert_ok(k_mutex_unlock(&mutex));
+	zassert_ok(k_thread_join(tid, K_FOREVER));
+
+	zassert_ok(k_mutex_spin_stats_get(&mutex, stats));
+}
+
+/**
+ * @brief Test that a short critical section is waited for by spinning
+ */
+ZTEST(mutex_spin, test_spin_acquired)
+{
+	struct k_mutex_spin_stats stats;
+
+	contend(HOLD_SHORT, &stats);
+
+	zassert_equal(stats.spins, 1);
+	zassert_equal(stats.spin_acquired, 1);
+	zassert_equal(stats.sleeps, 0);
+}
+
+/**
+ * @brief Test that spinning is bounded
+ */
+ZTEST(mutex_spin, test_spin_bounded)
+{
+	struct k_mutex_spin_stats stats;
+
+	contend(HOLD_LONG, &stats);
+
+	zassert_equal(stats.spins, 1);
+	zassert_equal(stats.spin_acquired, 0);
+	zassert_equal(stats.sleeps, 1);
+}
+
+/**
+ * @brief Test that the time spent spinning counts towards the timeout
+ */
+ZTEST(mutex_spin, test_spin_timeout)
+{
+	struct k_mutex_spin_stats stats;
+	k_tid_t tid = start_owner(HOLD_LONG);
+	uint32_t start = k_cycle_get_32();
+	uint32_t elapsed_us;
+
+	zassert_equal(k_mutex_lock(&mutex, K_USEC(TIMEOUT_US)), -EAGAIN);
+	elapsed_us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+
+	zassert_ok(k_thread_join(tid, K_FOREVER));
+	zassert_ok(k_mutex_spin_stats_get(&mutex, &stats));
+
+	zassert_equal(stats.spins, 1);
+	zassert_equal(stats.sleeps, 1);
+	/* Spinning, then pending for the whole timeout, would take longer */
+	zassert_true(elapsed_us < TIMEOUT_US + CONFIG_MUTEX_ADAPTIVE_SPIN_US,
+		     "waited %u us for a %u us timeout", elapsed_us, TIMEOUT_US);
+}
+
+/**
+ * @brief Test that an owner which isn't running is not spun on
+ */
+ZTEST(mutex_spin, test_owner_sleeping)
+{
+	struct k_mutex_spin_stats stats;
+
+	contend(HOLD_SLEEPING, &stats);
+
+	zassert_equal(stats.spins, 0);
+	zassert_equal(stats.sleeps, 1);
+}
+
+/**
+ * @brief Test that invalid arguments are rejected
+ */
+ZTEST(mutex_spin, test_invalid)
+{
+	struct k_mutex_spin_stats stats;
+
+	zassert_equal(k_mutex_spin_stats_get(NULL, &stats), -EINVAL);
+	zassert_equal(k_mutex_spin_stats_get(&mutex, NULL), -EINVAL);
+	zassert_equal(k_mutex_spin_stats_reset(NULL), -EINVAL);
+}
+
+ZTEST_SUITE(mutex_spin, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_queue.h"
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BATCH_LEN 6
+#define TIMEOUT_MS 100
+
+static K_THREAD_STACK_DEFINE(batch_stack, STACK_SIZE);
+static struct k_thread batch_thread;
+static ZTEST_BMEM struct qdata bdata[BATCH_LEN];
+static ZTEST_BMEM void *items[BATCH_LEN];
+static ZTEST_BMEM void *got[BATCH_LEN + 2];
+static ZTEST_BMEM int thread_ret;
+static K_FIFO_DEFINE(batch_fifo);
+
+static struct k_queue *batch_queue_get(void)
+{
+#ifdef CONFIG_USERSPACE
+	return k_object_alloc(K_OBJ_QUEUE);
+#else
+	static struct k_queue queue;
+
+	return &queue;
+#endif
+}
+
+/**
+ * @brief Test appending and getting several queue items at once
+ *
+ * @ingroup kernel_queue_tests
+ *
+ * @see k_queue_alloc_append_many(), k_queue_get_many()
+ */
+ZTEST_USER(queue_api, test_queue_batch_append_get)
+{
+	struct k_queue *q = batch_queue_get();
+
+	zassert_not_null(q, "no memory for allocated queue object");
+	k_queue_init(q);
+
+	for (int i = 0; i < BATCH_LEN; i++) {
+		bdata[i].data = i;
+		items[i] = &bdata[i];
+	}
+
+	zassert_equal(k_queue_alloc_append_many(q, items, BATCH_LEN),
+		      BATCH_LEN);
+
+	/**TESTPOINT: items come out in order, up to the given count */
+	zassert_equal(k_queue_get_many(q, got, 2, K_NO_WAIT), 2);
+	zassert_equal(k_queue_get_many(q, got + 2, ARRAY_SIZE(got) - 2,
+				       K_NO_WAIT), BATCH_LEN - 2);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal_ptr(got[i], &bdata[i]);
+	}
+
+	zassert_equal(k_queue_get_many(q, got, BATCH_LEN, K_NO_WAIT), 0);
+	zassert_equal(k_queue_get_many(q, got, BATCH_LEN, K_MSEC(TIMEOUT_MS)),
+		      0);
+}
+
+static void get_many_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_queue_get_many(p1, got, BATCH_LEN, K_FOREVER);
+}
+
+/**
+ * @brief Test that a waiting thread gets a whole batch of queue items
+ *
+ * @ingroup kernel_queue_tests
+ *
+ * @see k_queue_alloc_append_many(), k_queue_get_many()
+ */
+ZTEST(queue_api_1cpu, test_queue_batch_pending)
+{
+	static struct k_queue queue;
+
+	k_queue_init(&queue);
+
+	for (int i = 0; i < BATCH_LEN; i++) {
+		items[i] = &bdata[i];
+	}
+
+	k_thread_create(&batch_thread, batch_stack, STACK_SIZE,
+			get_many_entry, &queue, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_queue_alloc_append_many(&queue, items, 3), 3);
+	k_thread_join(&batch_thread, K_FOREVER);
+
+	zassert_equal(thread_ret, 3);
+	for (int i = 0; i < 3; i++) {
+		zassert_equal_ptr(got[i], &bdata[i]);
+	}
+	zassert_true(k_queue_is_empty(&queue));
+
+	/* The cancelled wait returns no items */
+	k_thread_create(&batch_thread, batch_stack, STACK_SIZE,
+			get_many_entry, &queue, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	k_queue_cancel_wait(&queue);
+	k_thread_join(&batch_thread, K_FOREVER);
+	zassert_equal(thread_ret, 0);
+}
+
+/**
+ * @brief Test getting several FIFO items at once
+ *
+ * @ingroup kernel_queue_tests
+ *
+ * @see k_fifo_put_list(), k_fifo_get_many()
+ */
+ZTEST(queue_api, test_fifo_get_many)
+{
+	for (int i = 0; i < BATCH_LEN - 1; i++) {
+		bdata[i].snode.next = &bdata[i + 1].snode;
+	}
+	bdata[BATCH_LEN - 1].snode.next = NULL;
+
+	k_fifo_put_list(&batch_fifo, &bdata[0], &bdata[BATCH_LEN - 1]);
+
+	zassert_equal(k_fifo_get_many(&batch_fifo, got, ARRAY_SIZE(got),
+				      K_NO_WAIT), BATCH_LEN);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal_ptr(got[i], &bdata[i]);
+	}
+	zassert_true(k_fifo_is_empty(&batch_fifo));
+}
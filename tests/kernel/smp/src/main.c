@@ -753,6 +753,53 @@ ZTEST(smp, test_smp_ipi)
 }
 #endif
 
+/**
+ * @brief Test interprocessor interrupt directed to a single CPU
+ *
+ * @ingroup kernel_smp_integration_tests
+ *
+ * @details Interrupt each other CPU in turn with arch_sched_directed_ipi()
+ * and check that z_sched_ipi() was called, and that an empty bitmap and
+ * the current CPU alone interrupt nobody.  Busy waiting keeps this
+ * thread running, so no other scheduler IPI is expected meanwhile.
+ *
+ * @see arch_sched_directed_ipi()
+ */
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+ZTEST(smp, test_smp_directed_ipi)
+{
+#ifndef CONFIG_TRACE_SCHED_IPI
+	ztest_test_skip();
+#endif
+
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int key;
+	int cpu;
+
+	for (int i = 0; i < num_cpus; i++) {
+		key = arch_irq_lock();
+		cpu = curr_cpu();
+
+		sched_ipi_has_called = 0;
+		arch_sched_directed_ipi(BIT(i));
+		arch_irq_unlock(key);
+
+		k_busy_wait(100 * USEC_PER_MSEC);
+
+		/**TESTPOINT: only the targeted CPU enters the IPI handler */
+		zassert_equal(sched_ipi_has_called != 0, i != cpu,
+			      "wrong IPI count for CPU %d (%d)", i,
+			      sched_ipi_has_called);
+	}
+
+	sched_ipi_has_called = 0;
+	arch_sched_directed_ipi(0);
+	k_busy_wait(100 * USEC_PER_MSEC);
+
+	zassert_equal(sched_ipi_has_called, 0, "IPI sent for empty bitmap");
+}
+#endif
+
 void k_sys_fatal_error_handler(unsigned int reason, const z_arch_esf_t *esf)
 {
 	static int trigger;
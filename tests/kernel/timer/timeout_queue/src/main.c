@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_TIMERS 64
+
+/* Timers started after these expire at the same ticks as the first ones */
+#define NUM_UNIQUE 48
+
+/* Spans all the levels of the timing wheel and beyond */
+#define MAX_BITS 27
+
+#define PERIOD 97
+#define NUM_PERIODS 200
+
+static struct k_timer timers[NUM_TIMERS];
+static k_ticks_t expected[NUM_TIMERS];
+static k_ticks_t fired_at[NUM_TIMERS];
+static int fired_order[NUM_TIMERS];
+static int fired_count;
+
+static struct k_timer periodic;
+static k_ticks_t periodic_start;
+static int periodic_count;
+static bool periodic_late;
+
+static K_SEM_DEFINE(done, 0, 1);
+
+static uint32_t seed;
+
+static uint32_t next_rand(void)
+{
+	seed = seed * 1103515245U + 12345U;
+
+	return seed >> 8;
+}
+
+static void timer_expired(struct k_timer *timer)
+{
+	int i = timer - timers;
+
+	fired_at[i] = k_uptime_ticks();
+	fired_order[fired_count++] = i;
+}
+
+/* Expiry ticks on both sides of the wheel level boundaries, and random
+ * ones up to 2^MAX_BITS ticks from now
+ */
+static k_ticks_t init_expected(void)
+{
+	static const k_ticks_t offsets[] = {
+		-1, 0, 1, 63, 64, 65, 4095, 4096, 4097, 262143, 262144,
+		16777215, 16777216, 16777217,
+	};
+	k_ticks_t now = k_uptime_ticks();
+	k_ticks_t base = (now | (BIT(24) - 1)) + 1;
+	k_ticks_t last = 0;
+	int i;
+
+	seed = 12345U;
+
+	for (i = 0; i < NUM_UNIQUE; i++) {
+		if (i < ARRAY_SIZE(offsets)) {
+			expected[i] = base + offsets[i];
+		} else {
+			uint64_t r = ((uint64_t)next_rand() << 24) | next_rand();
+
+			expected[i] = now + 1 + r % BIT64(i % MAX_BITS + 1);
+		}
+	}
+
+	for (; i < NUM_TIMERS; i++) {
+		expected[i] = expected[i - NUM_UNIQUE];
+	}
+
+	for (i = 0; i < NUM_TIMERS; i++) {
+		last = MAX(last, expected[i]);
+	}
+
+	return last;
+}
+
+static void start_timers(void)
+{
+	fired_count = 0;
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		fired_at[i] = 0;
+		k_timer_init(&timers[i], timer_expired, NULL);
+		k_timer_start(&timers[i], K_TIMEOUT_ABS_TICKS(expected[i]),
+			      K_NO_WAIT);
+	}
+}
+
+static void sleep_until(k_ticks_t tick)
+{
+	k_sleep(K_TIMEOUT_ABS_TICKS(tick + 1));
+}
+
+static void check_fired(uint32_t skip_mask)
+{
+	int order[NUM_TIMERS];
+	int count = 0;
+
+	/* Timers expiring at the same tick fire in the order of starting */
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		int j;
+
+		if ((i < 32) && (skip_mask & BIT(i))) {
+			continue;
+		}
+
+		for (j = count; j > 0 && expected[order[j - 1]] > expected[i];
+		     j--) {
+			order[j] = order[j - 1];
+		}
+
+		order[j] = i;
+		count++;
+	}
+
+	zassert_equal(fired_count, count, "%d timers fired, expected %d",
+		      fired_count, count);
+
+	for (int i = 0; i < count; i++) {
+		int t = order[i];
+
+		zassert_equal(fired_order[i], t, "Timer %d fired before %d",
+			      fired_order[i], t);
+		zassert_equal(fired_at[t], expected[t],
+			      "Timer %d fired at %lld, expected %lld", t,
+			      fired_at[t], expected[t]);
+	}
+}
+
+ZTEST(timeout_queue, test_expiry_order)
+{
+	k_ticks_t last = init_expected();
+
+	start_timers();
+	sleep_until(last);
+
+	check_fired(0);
+}
+
+ZTEST(timeout_queue, test_remaining_and_stop)
+{
+	k_ticks_t last = init_expected();
+	uint32_t stopped = 0;
+
+	start_timers();
+
+	for (int i = 0; i < NUM_TIMERS; i++) {
+		zassert_equal(k_timer_remaining_ticks(&timers[i]),
+			      expected[i] - k_uptime_ticks(),
+			      "Wrong remaining ticks for timer %d", i);
+	}
+
+	/* Stopping timers does not disturb the others */
+	for (int i = 1; i < 32; i += 2) {
+		k_timer_stop(&timers[i]);
+		stopped |= BIT(i);
+	}
+
+	sleep_until(last);
+
+	check_fired(stopped);
+}
+
+static void periodic_expired(struct k_timer *timer)
+{
+	periodic_count++;
+
+	if (k_uptime_ticks() != periodic_start + periodic_count * PERIOD) {
+		periodic_late = true;
+	}
+
+	if (periodic_count == NUM_PERIODS) {
+		k_timer_stop(timer);
+		k_sem_give(&done);
+	}
+}
+
+ZTEST(timeout_queue, test_periodic)
+{
+	periodic_count = 0;
+	periodic_late = false;
+
+	k_timer_init(&periodic, periodic_expired, NULL);
+
+	periodic_start = k_uptime_ticks();
+	k_timer_start(&periodic, K_TIMEOUT_ABS_TICKS(periodic_start + PERIOD),
+		      K_TICKS(PERIOD));
+
+	zassert_ok(k_sem_take(&done, K_TICKS(PERIOD * (NUM_PERIODS + 1))),
+		   "Periodic timer stopped firing");
+	zassert_false(periodic_late, "Periodic timer drifted");
+}
+
+ZTEST_SUITE(timeout_queue, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define DELAY 20
+#define SLACK 10
+#define OTHER_DELAY 26
+#define FAR_DELAY 80
+
+/* Ticks an expiry may be observed late by, e.g. because of rounding */
+#define MARGIN 2
+
+static struct k_timer slack_timer;
+static struct k_timer other_timer;
+static struct k_work_delayable slack_work;
+static int64_t slack_fired;
+static int64_t other_fired;
+static int64_t start;
+
+static K_SEM_DEFINE(work_sem, 0, 1);
+
+/* Uptime of the hardware clock, as expiry handlers see the uptime of the
+ * tick the timeout expires at
+ */
+static int64_t hw_ticks(void)
+{
+	return k_cyc_to_ticks_floor64(k_cycle_get_64());
+}
+
+static void slack_expired(struct k_timer *timer)
+{
+	slack_fired = hw_ticks();
+}
+
+static void other_expired(struct k_timer *timer)
+{
+	other_fired = hw_ticks();
+}
+
+static void slack_handler(struct k_work *work)
+{
+	slack_fired = hw_ticks();
+	k_sem_give(&work_sem);
+}
+
+static void assert_between(int64_t t, int64_t min, int64_t max)
+{
+	zassert_true((t - start >= min) && (t - start <= max + MARGIN),
+		     "fired after %lld ticks, expected %lld to %lld",
+		     t - start, min, max);
+}
+
+static void wait_tick(void)
+{
+	/* Start on a tick boundary, so that the delays are exact */
+	k_sleep(K_TICKS(1));
+	start = hw_ticks();
+}
+
+/**
+ * @brief Test that a timer is delayed within its slack to share a wakeup
+ */
+ZTEST(timer_slack, test_coalesce)
+{
+	struct k_timeout_slack_stats before, after;
+
+	k_timeout_slack_stats_get(&before);
+
+	k_timer_slack_set(&slack_timer, K_TICKS(SLACK));
+	wait_tick();
+	k_timer_start(&slack_timer, K_TICKS(DELAY), K_NO_WAIT);
+	k_timer_start(&other_timer, K_TICKS(OTHER_DELAY), K_NO_WAIT);
+
+	zassert_equal(k_timer_status_sync(&other_timer), 1);
+	zassert_equal(k_timer_status_get(&slack_timer), 1);
+
+	assert_between(slack_fired, OTHER_DELAY, OTHER_DELAY);
+	assert_between(other_fired, OTHER_DELAY, OTHER_DELAY);
+
+	k_timeout_slack_stats_get(&after);
+	zassert_true(after.wakeups_saved - before.wakeups_saved >= 1);
+}
+
+/**
+ * @brief Test that a timer is not delayed past its slack
+ */
+ZTEST(timer_slack, test_slack_limit)
+{
+	struct k_timeout_slack_stats before, after;
+
+	k_timeout_slack_stats_get(&before);
+
+	k_timer_slack_set(&slack_timer, K_TICKS(SLACK));
+	wait_tick();
+	k_timer_start(&slack_timer, K_TICKS(DELAY), K_NO_WAIT);
+	k_timer_start(&other_timer, K_TICKS(FAR_DELAY), K_NO_WAIT);
+
+	zassert_equal(k_timer_status_sync(&slack_timer), 1);
+	assert_between(slack_fired, DELAY, DELAY + SLACK);
+
+	zassert_equal(k_timer_status_sync(&other_timer), 1);
+	assert_between(other_fired, FAR_DELAY, FAR_DELAY);
+
+	k_timeout_slack_stats_get(&after);
+	zassert_equal(after.wakeups_saved, before.wakeups_saved);
+}
+
+/**
+ * @brief Test that a timeout added later wakes up the system earlier
+ *
+ * @details The timer with a slack expires first, but the one added after
+ * it expires before its slack ends.
+ */
+ZTEST(timer_slack, test_later_timeout)
+{
+	k_timer_slack_set(&slack_timer, K_TICKS(FAR_DELAY));
+	wait_tick();
+	k_timer_start(&slack_timer, K_TICKS(DELAY), K_NO_WAIT);
+	k_timer_start(&other_timer, K_TICKS(OTHER_DELAY), K_NO_WAIT);
+
+	zassert_equal(k_timer_status_sync(&slack_timer), 1);
+	assert_between(slack_fired, OTHER_DELAY, OTHER_DELAY);
+	assert_between(other_fired, OTHER_DELAY, OTHER_DELAY);
+}
+
+/**
+ * @brief Test that reducing the slack of a running timer takes effect
+ */
+ZTEST(timer_slack, test_slack_reduced)
+{
+	k_timer_slack_set(&slack_timer, K_TICKS(FAR_DELAY));
+	wait_tick();
+	k_timer_start(&slack_timer, K_TICKS(DELAY), K_NO_WAIT);
+	k_timer_slack_set(&slack_timer, K_NO_WAIT);
+
+	zassert_equal(k_timer_status_sync(&slack_timer), 1);
+	assert_between(slack_fired, DELAY, DELAY);
+}
+
+/**
+ * @brief Test that a periodic timer with a slack doesn't drift
+ */
+ZTEST(timer_slack, test_periodic)
+{
+	k_timer_slack_set(&slack_timer, K_TICKS(SLACK));
+	wait_tick();
+	k_timer_start(&slack_timer, K_TICKS(DELAY), K_TICKS(DELAY));
+
+	for (int i = 1; i <= 5; i++) {
+		zassert_equal(k_timer_status_sync(&slack_timer), 1);
+		assert_between(slack_fired, i * DELAY, i * DELAY + SLACK);
+	}
+
+	k_timer_stop(&slack_timer);
+}
+
+/**
+ * @brief Test that k_sleep() is delayed within the thread's slack
+ */
+ZTEST(timer_slack, test_sleep)
+{
+	int64_t woken;
+
+	k_thread_timeout_slack_set(k_current_get(), K_TICKS(SLACK));
+	wait_tick();
+	k_timer_start(&other_timer, K_TICKS(OTHER_DELAY), K_NO_WAIT);
+
+	k_sleep(K_TICKS(DELAY));
+	woken = hw_ticks();
+	k_thread_timeout_slack_set(k_current_get(), K_NO_WAIT);
+
+	zassert_equal(k_timer_status_get(&other_timer), 1);
+	assert_between(woken, OTHER_DELAY, OTHER_DELAY);
+}
+
+/**
+ * @brief Test that a delayable work item is delayed within its slack
+ */
+ZTEST(timer_slack, test_work)
+{
+	k_work_delayable_slack_set(&slack_work, K_TICKS(SLACK));
+	wait_tick();
+	zassert_equal(k_work_schedule(&slack_work, K_TICKS(DELAY)), 1);
+	k_timer_start(&other_timer, K_TICKS(OTHER_DELAY), K_NO_WAIT);
+
+	zassert_ok(k_sem_take(&work_sem, K_FOREVER));
+	assert_between(slack_fired, OTHER_DELAY, OTHER_DELAY);
+}
+
+static void before(void *fixture)
+{
+	k_timer_init(&slack_timer, slack_expired, NULL);
+	k_timer_init(&other_timer, other_expired, NULL);
+	k_work_init_delayable(&slack_work, slack_handler);
+	slack_fired = 0;
+	other_fired = 0;
+}
+
+ZTEST_SUITE(timer_slack, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define TEST_PRIORITY K_PRIO_PREEMPT(5)
+#define NUM_WAKEUPS 10
+#define DELAY_MS 10
+
+static K_THREAD_STACK_DEFINE(helper_stack, STACK_SIZE);
+static struct k_thread helper_thread;
+static K_SEM_DEFINE(wake_sem, 0, 1);
+
+static void waiter_entry(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < NUM_WAKEUPS; i++) {
+		k_sem_take(&wake_sem, K_FOREVER);
+	}
+}
+
+static void idle_entry(void *p1, void *p2, void *p3)
+{
+}
+
+static uint32_t histogram_sum(const struct k_sched_latency_stats *stats)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(stats->histogram); i++) {
+		sum += stats->histogram[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Test that wakeups and preemptions are counted
+ *
+ * @details A higher priority thread is started and woken up a number of
+ * times by the test thread, preempting it each time.
+ */
+ZTEST(sched_latency, test_wakeups)
+{
+	struct k_sched_latency_stats stats;
+	struct k_sched_latency_stats cpu_before, cpu_after;
+	uint32_t preemptions;
+	k_tid_t tid;
+
+	k_thread_priority_set(k_current_get(), TEST_PRIORITY);
+
+	zassert_ok(k_thread_sched_latency_get(k_current_get(), &stats));
+	preemptions = stats.preemptions;
+	zassert_ok(k_cpu_sched_latency_get(0, &cpu_before));
+
+	tid = k_thread_create(&helper_thread, helper_stack, STACK_SIZE,
+			      waiter_entry, NULL, NULL, NULL,
+			      TEST_PRIORITY - 1, 0, K_NO_WAIT);
+
+	for (int i = 0; i < NUM_WAKEUPS; i++) {
+		k_sem_give(&wake_sem);
+	}
+	k_thread_join(tid, K_FOREVER);
+
+	/* Starting the thread counts as a wakeup too */
+	zassert_ok(k_thread_sched_latency_get(tid, &stats));
+	zassert_equal(stats.wakeups, NUM_WAKEUPS + 1);
+	zassert_equal(histogram_sum(&stats), stats.wakeups);
+	zassert_equal(stats.preemptions, 0);
+
+	zassert_ok(k_thread_sched_latency_get(k_current_get(), &stats));
+	zassert_equal(stats.preemptions - preemptions, NUM_WAKEUPS + 1);
+
+	zassert_ok(k_cpu_sched_latency_get(0, &cpu_after));
+	zassert_true(cpu_after.wakeups - cpu_before.wakeups >=
+		     NUM_WAKEUPS + 1);
+	zassert_true(cpu_after.preemptions - cpu_before.preemptions >=
+		     NUM_WAKEUPS + 1);
+	zassert_equal(histogram_sum(&cpu_after), cpu_after.wakeups);
+}
+
+/**
+ * @brief Test that the time a thread waits to run is measured
+ *
+ * @details A lower priority thread is started while the test thread
+ * keeps the CPU busy, so it only runs once the test thread blocks.
+ */
+ZTEST(sched_latency, test_latency)
+{
+	struct k_sched_latency_stats stats;
+	uint32_t min_cycles = k_ms_to_cyc_floor32(DELAY_MS / 2);
+	unsigned int bucket;
+	k_tid_t tid;
+
+	k_thread_priority_set(k_current_get(), TEST_PRIORITY);
+
+	tid = k_thread_create(&helper_thread, helper_stack, STACK_SIZE,
+			      idle_entry, NULL, NULL, NULL,
+			      TEST_PRIORITY + 1, 0, K_NO_WAIT);
+
+	k_busy_wait(DELAY_MS * USEC_PER_MSEC);
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_ok(k_thread_sched_latency_get(tid, &stats));
+	zassert_equal(stats.wakeups, 1);
+	zassert_true(stats.max_latency >= min_cycles,
+		     "latency %u cycles, expected at least %u",
+		     stats.max_latency, min_cycles);
+	zassert_true(stats.ready_cycles >= stats.max_latency);
+
+	bucket = MIN(find_msb_set(stats.max_latency),
+		     CONFIG_SCHED_LATENCY_STATS_BUCKETS - 1);
+	zassert_equal(stats.histogram[bucket], 1);
+	zassert_equal(histogram_sum(&stats), 1);
+}
+
+/**
+ * @brief Test resetting statistics and rejecting invalid arguments
+ */
+ZTEST(sched_latency, test_reset)
+{
+	struct k_sched_latency_stats stats;
+
+	zassert_ok(k_thread_sched_latency_reset(k_current_get()));
+	zassert_ok(k_thread_sched_latency_get(k_current_get(), &stats));
+	zassert_equal(stats.wakeups, 0);
+	zassert_equal(stats.preemptions, 0);
+	zassert_equal(histogram_sum(&stats), 0);
+
+	zassert_ok(k_cpu_sched_latency_reset(0));
+	zassert_ok(k_cpu_sched_latency_get(0, &stats));
+	zassert_equal(stats.max_latency, 0);
+	zassert_equal(stats.ready_cycles, 0);
+
+	zassert_equal(k_thread_sched_latency_get(NULL, &stats), -EINVAL);
+	zassert_equal(k_thread_sched_latency_get(k_current_get(), NULL),
+		      -EINVAL);
+	zassert_equal(k_cpu_sched_latency_get(-1, &stats), -EINVAL);
+	zassert_equal(k_cpu_sched_latency_get(CONFIG_MP_MAX_NUM_CPUS, &stats),
+		      -EINVAL);
+	zassert_equal(k_cpu_sched_latency_reset(CONFIG_MP_MAX_NUM_CPUS),
+		      -EINVAL);
+}
+
+ZTEST_SUITE(sched_latency, NULL, NULL, NULL, NULL, NULL);
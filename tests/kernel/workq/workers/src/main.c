@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 2
+#define NUM_THREADS (NUM_WORKERS + 1)
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define QUEUE_PRIORITY K_PRIO_COOP(1)
+#define RUN_MS 50
+
+static K_THREAD_STACK_DEFINE(queue_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NUM_WORKERS, STACK_SIZE);
+static struct k_work_q queue;
+static struct k_work_queue_worker workers[NUM_WORKERS];
+
+static K_SEM_DEFINE(release, 0, NUM_THREADS);
+static struct k_work_sync sync;
+static struct k_work works[NUM_THREADS];
+static struct k_work spare;
+static atomic_t started;
+static atomic_t runs;
+static atomic_t active;
+static atomic_t max_active;
+static k_tid_t ran_on[NUM_THREADS];
+
+static void reset(void)
+{
+	k_sem_reset(&release);
+	atomic_clear(&started);
+	atomic_clear(&runs);
+	atomic_clear(&active);
+	atomic_clear(&max_active);
+}
+
+static void blocking_handler(struct k_work *work)
+{
+	ran_on[work - works] = k_current_get();
+	atomic_inc(&started);
+	k_sem_take(&release, K_FOREVER);
+}
+
+/* Counts runs and how many run at once, taking a while to complete */
+static void counting_handler(struct k_work *work)
+{
+	atomic_val_t now = atomic_inc(&active) + 1;
+
+	if (now > atomic_get(&max_active)) {
+		atomic_set(&max_active, now);
+	}
+
+	k_msleep(RUN_MS);
+
+	atomic_dec(&active);
+	atomic_inc(&runs);
+}
+
+static void chaining_handler(struct k_work *work)
+{
+	/* Lands on the list of this thread, others must take it */
+	zassert_equal(k_work_submit_to_queue(&queue, &works[1]), 1);
+	zassert_equal(k_work_submit_to_queue(&queue, &works[2]), 1);
+
+	blocking_handler(work);
+}
+
+static void release_all(void)
+{
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_sem_give(&release);
+	}
+	zassert_equal(k_work_queue_drain(&queue, false), 1);
+}
+
+/* Different work items run concurrently, on different threads */
+ZTEST(workers, test_concurrent)
+{
+	reset();
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_work_init(&works[i], blocking_handler);
+		zassert_equal(k_work_submit_to_queue(&queue, &works[i]), 1);
+	}
+
+	k_msleep(RUN_MS);
+	zassert_equal(atomic_get(&started), NUM_THREADS,
+		      "work items did not run concurrently");
+	zassert_not_equal(ran_on[0], ran_on[1]);
+	zassert_not_equal(ran_on[1], ran_on[2]);
+	zassert_not_equal(ran_on[0], ran_on[2]);
+
+	release_all();
+}
+
+/* Idle threads take work submitted by a busy one */
+ZTEST(workers, test_steal)
+{
+	reset();
+
+	k_work_init(&works[0], chaining_handler);
+	k_work_init(&works[1], blocking_handler);
+	k_work_init(&works[2], blocking_handler);
+
+	zassert_equal(k_work_submit_to_queue(&queue, &works[0]), 1);
+
+	k_msleep(RUN_MS);
+	zassert_equal(atomic_get(&started), NUM_THREADS,
+		      "chained work items were not taken by other threads");
+
+	release_all();
+}
+
+/* A work item submitted while running runs again only once it completes,
+ * and a flush waits for both runs.
+ */
+ZTEST(workers, test_no_reentrancy)
+{
+	reset();
+
+	k_work_init(&works[0], counting_handler);
+	zassert_equal(k_work_submit_to_queue(&queue, &works[0]), 1);
+	k_msleep(RUN_MS / 5);
+
+	zassert_equal(k_work_submit_to_queue(&queue, &works[0]), 2);
+	zassert_equal(k_work_busy_get(&works[0]),
+		      K_WORK_RUNNING | K_WORK_QUEUED);
+
+	zassert_true(k_work_flush(&works[0], &sync));
+	zassert_equal(atomic_get(&runs), 2);
+	zassert_equal(atomic_get(&max_active), 1, "work item ran concurrently");
+	zassert_equal(k_work_busy_get(&works[0]), 0);
+}
+
+/* Cancelling drops the queued run and waits for the running one */
+ZTEST(workers, test_cancel_sync)
+{
+	reset();
+
+	k_work_init(&works[0], counting_handler);
+	zassert_equal(k_work_submit_to_queue(&queue, &works[0]), 1);
+	k_msleep(RUN_MS / 5);
+	zassert_equal(k_work_submit_to_queue(&queue, &works[0]), 2);
+
+	zassert_true(k_work_cancel_sync(&works[0], &sync));
+	zassert_equal(atomic_get(&runs), 1);
+	zassert_equal(k_work_busy_get(&works[0]), 0);
+
+	/* Nothing left to run */
+	zassert_equal(k_work_queue_drain(&queue, false), 0);
+	zassert_equal(atomic_get(&runs), 1);
+}
+
+static void cancel_spare(struct k_timer *timer)
+{
+	zassert_equal(k_work_cancel(&spare), 0);
+}
+
+static K_TIMER_DEFINE(cancel_timer, cancel_spare, NULL);
+
+/* A flush of a queued item returns when the item gets cancelled */
+ZTEST(workers, test_flush_cancelled)
+{
+	reset();
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_work_init(&works[i], blocking_handler);
+		zassert_equal(k_work_submit_to_queue(&queue, &works[i]), 1);
+	}
+
+	/* All threads are busy, so this one stays queued */
+	k_work_init(&spare, counting_handler);
+	k_msleep(RUN_MS / 5);
+	zassert_equal(k_work_submit_to_queue(&queue, &spare), 1);
+
+	k_timer_start(&cancel_timer, K_MSEC(RUN_MS), K_NO_WAIT);
+	zassert_true(k_work_flush(&spare, &sync));
+	zassert_equal(k_work_busy_get(&spare), 0);
+
+	release_all();
+	zassert_equal(atomic_get(&runs), 0);
+}
+
+/* Draining waits for all threads to complete */
+ZTEST(workers, test_drain)
+{
+	reset();
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_work_init(&works[i], counting_handler);
+		zassert_equal(k_work_submit_to_queue(&queue, &works[i]), 1);
+	}
+
+	zassert_equal(k_work_queue_drain(&queue, false), 1);
+	zassert_equal(atomic_get(&runs), NUM_THREADS);
+	zassert_equal(atomic_get(&max_active), NUM_THREADS);
+}
+
+/* The system work queue runs items concurrently when it has workers */
+ZTEST(workers, test_system_queue)
+{
+	if (CONFIG_SYSTEM_WORKQUEUE_WORKERS == 0) {
+		ztest_test_skip();
+	}
+
+	reset();
+
+	for (int i = 0; i < 2; i++) {
+		k_work_init(&works[i], blocking_handler);
+		zassert_equal(k_work_submit(&works[i]), 1);
+	}
+
+	k_msleep(RUN_MS);
+	zassert_equal(atomic_get(&started), 2,
+		      "system work items did not run concurrently");
+
+	for (int i = 0; i < 2; i++) {
+		k_sem_give(&release);
+	}
+	zassert_equal(k_work_queue_drain(&k_sys_work_q, false), 1);
+}
+
+static void *workers_setup(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "workers",
+	};
+
+	k_work_queue_start(&queue, queue_stack, K_THREAD_STACK_SIZEOF(queue_stack),
+			   QUEUE_PRIORITY, &cfg);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_queue_add_worker(&queue, &workers[i], worker_stacks[i],
+					K_THREAD_STACK_SIZEOF(worker_stacks[i]), -1);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(workers, NULL, workers_setup, NULL, NULL, NULL);
@@ -268,6 +268,61 @@ ZTEST(lib_heap, test_solo_free_header)
 	}
 }
 
+/* Freed small chunks between used ones are reused by size without
+ * merging, count as free in the stats, and merge again when a big
+ * allocation needs the space.  A heap of SMALL_HEAP_SZ caches chunks
+ * of up to 32 bytes, and up to 128 bytes of them.
+ */
+ZTEST(lib_heap, test_size_classes)
+{
+	struct sys_heap heap;
+	void *small[SMALL_HEAP_SZ / 32];
+	void *p1, *p2;
+	int n;
+
+	if (!IS_ENABLED(CONFIG_SYS_HEAP_SIZE_CLASSES)) {
+		ztest_test_skip();
+	}
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+
+	p1 = sys_heap_alloc(&heap, 16);
+	p2 = sys_heap_alloc(&heap, 16);
+	sys_heap_free(&heap, p1);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	zassert_equal(sys_heap_alloc(&heap, 14), p1,
+		      "Cached chunk of the same size not reused");
+	sys_heap_free(&heap, p1);
+	sys_heap_free(&heap, p2);
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	struct sys_memory_stats stats;
+
+	sys_heap_runtime_stats_get(&heap, &stats);
+	zassert_equal(stats.allocated_bytes, 0, "Cached chunks counted as allocated");
+#endif
+
+	/* Fill the heap with small chunks, then free them all */
+	for (n = 0; n < ARRAY_SIZE(small); n++) {
+		small[n] = sys_heap_alloc(&heap, 24);
+		if (small[n] == NULL) {
+			break;
+		}
+	}
+	zassert_true(n > 1, "Small allocations failed");
+
+	for (int i = 0; i < n; i++) {
+		sys_heap_free(&heap, small[i]);
+	}
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+
+	p1 = sys_heap_alloc(&heap, SMALL_HEAP_SZ / 2);
+	zassert_not_null(p1, "Cached chunks not merged for a big allocation");
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+	sys_heap_free(&heap, p1);
+}
+
 /* Simple clobber detection */
 void realloc_fill_block(uint8_t *p, size_t sz)
 {
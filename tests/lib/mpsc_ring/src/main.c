@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/ztress.h>
+#include <zephyr/sys/mpsc_ring.h>
+#include <zephyr/random/rand32.h>
+
+#define NUM_ELEMS 4
+#define TIMEOUT_MS 50
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define STRESS_TIMEOUT_MS ((CONFIG_SYS_CLOCK_TICKS_PER_SEC < 10000) ? 1000 : 15000)
+#define NUM_PRODUCERS 2
+
+struct elem {
+	uint16_t producer;
+	uint16_t seq;
+	uint32_t data;
+};
+
+MPSC_RING_DEFINE(static_ring, struct elem, 8, MPSC_RING_SINGLE_PRODUCER);
+
+static struct mpsc_ring ring;
+static uint32_t buf[NUM_ELEMS];
+static atomic_t seq[NUM_ELEMS];
+
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+static struct k_thread consumer_thread;
+static uint32_t consumed[NUM_ELEMS];
+static int consumed_cnt;
+static uint32_t produced_cnt;
+
+static void ring_setup(uint32_t flags)
+{
+	mpsc_ring_init(&ring, buf, seq, sizeof(buf[0]), NUM_ELEMS, flags);
+}
+
+static void put_get(uint32_t flags)
+{
+	uint32_t val;
+
+	ring_setup(flags);
+
+	/* Fill and empty the ring a few times to go around */
+	for (uint32_t lap = 0; lap < 3; lap++) {
+		for (uint32_t i = 0; i < NUM_ELEMS; i++) {
+			val = lap * NUM_ELEMS + i;
+			zassert_ok(mpsc_ring_put(&ring, &val));
+		}
+
+		zassert_equal(mpsc_ring_put(&ring, &val), -ENOMEM);
+		zassert_is_null(mpsc_ring_put_claim(&ring));
+
+		for (uint32_t i = 0; i < NUM_ELEMS; i++) {
+			zassert_ok(mpsc_ring_get(&ring, &val, K_NO_WAIT));
+			zassert_equal(val, lap * NUM_ELEMS + i);
+		}
+
+		zassert_false(mpsc_ring_is_pending(&ring));
+		zassert_equal(mpsc_ring_get(&ring, &val, K_NO_WAIT), -ENOMSG);
+	}
+
+	zassert_equal(mpsc_ring_get(&ring, &val, K_MSEC(TIMEOUT_MS)), -EAGAIN);
+}
+
+ZTEST(mpsc_ring, test_put_get)
+{
+	put_get(0);
+}
+
+ZTEST(mpsc_ring, test_put_get_single_producer)
+{
+	put_get(MPSC_RING_SINGLE_PRODUCER);
+}
+
+/* Elements are read in the order of claiming, whatever the commit order */
+ZTEST(mpsc_ring, test_commit_order)
+{
+	uint32_t *a, *b, *c;
+
+	ring_setup(0);
+
+	a = mpsc_ring_put_claim(&ring);
+	b = mpsc_ring_put_claim(&ring);
+	zassert_not_null(a);
+	zassert_not_null(b);
+	zassert_not_equal(a, b);
+	*a = 1;
+	*b = 2;
+
+	mpsc_ring_put_commit(&ring, b);
+	zassert_false(mpsc_ring_is_pending(&ring));
+	zassert_is_null(mpsc_ring_get_claim(&ring, K_NO_WAIT));
+
+	mpsc_ring_put_commit(&ring, a);
+	c = mpsc_ring_get_claim(&ring, K_NO_WAIT);
+	zassert_equal_ptr(c, a);
+	zassert_equal(*c, 1);
+	mpsc_ring_free(&ring, c);
+
+	c = mpsc_ring_get_claim(&ring, K_NO_WAIT);
+	zassert_equal_ptr(c, b);
+	zassert_equal(*c, 2);
+	mpsc_ring_free(&ring, c);
+
+	zassert_is_null(mpsc_ring_get_claim(&ring, K_NO_WAIT));
+}
+
+/* A statically defined ring is usable without initialization */
+ZTEST(mpsc_ring, test_static)
+{
+	struct elem *e;
+
+	for (uint16_t i = 0; i < 20; i++) {
+		e = mpsc_ring_put_claim(&static_ring);
+		zassert_not_null(e);
+		e->seq = i;
+		mpsc_ring_put_commit(&static_ring, e);
+
+		e = mpsc_ring_get_claim(&static_ring, K_NO_WAIT);
+		zassert_not_null(e);
+		zassert_equal(e->seq, i);
+		mpsc_ring_free(&static_ring, e);
+	}
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < NUM_ELEMS; i++) {
+		if (mpsc_ring_get(&ring, &consumed[i], K_FOREVER) == 0) {
+			consumed_cnt++;
+		}
+	}
+}
+
+static void producer_timer_handler(struct k_timer *timer)
+{
+	zassert_ok(mpsc_ring_put(&ring, &produced_cnt));
+	produced_cnt++;
+
+	if (produced_cnt == NUM_ELEMS) {
+		k_timer_stop(timer);
+	}
+}
+
+static K_TIMER_DEFINE(producer_timer, producer_timer_handler, NULL);
+
+/* A consumer blocked on an empty ring is woken up by an interrupt */
+ZTEST(mpsc_ring, test_blocking_get)
+{
+	ring_setup(0);
+	consumed_cnt = 0;
+	produced_cnt = 0;
+
+	k_thread_create(&consumer_thread, consumer_stack, STACK_SIZE,
+			consumer_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_timer_start(&producer_timer, K_MSEC(1), K_MSEC(1));
+	zassert_ok(k_thread_join(&consumer_thread, K_MSEC(TIMEOUT_MS * 10)));
+
+	zassert_equal(consumed_cnt, NUM_ELEMS);
+	for (int i = 0; i < NUM_ELEMS; i++) {
+		zassert_equal(consumed[i], i);
+	}
+}
+
+/* The ring semaphore can be polled for together with other objects */
+ZTEST(mpsc_ring, test_poll)
+{
+	struct k_poll_event event;
+	uint32_t val = 0x1234;
+
+	ring_setup(0);
+
+	k_poll_event_init(&event, K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, mpsc_ring_sem_get(&ring));
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	zassert_ok(mpsc_ring_put(&ring, &val));
+	zassert_ok(k_poll(&event, 1, K_NO_WAIT));
+	zassert_equal(event.state, K_POLL_STATE_SEM_AVAILABLE);
+
+	val = 0;
+	zassert_ok(mpsc_ring_get(&ring, &val, K_NO_WAIT));
+	zassert_equal(val, 0x1234);
+}
+
+struct stress_data {
+	struct mpsc_ring ring;
+	struct elem buf[16];
+	atomic_t seq[16];
+	uint16_t write_cnt[NUM_PRODUCERS];
+	uint16_t read_cnt[NUM_PRODUCERS];
+	uint32_t wr_err;
+	uint32_t reads;
+};
+
+static bool stress_read(void *user_data, uint32_t cnt, bool last, int prio)
+{
+	struct stress_data *ctx = user_data;
+	int rpt = (sys_rand32_get() & 7) + 1;
+	struct elem *e;
+
+	for (int i = 0; i < rpt; i++) {
+		e = mpsc_ring_get_claim(&ctx->ring, K_NO_WAIT);
+		if (e == NULL) {
+			return true;
+		}
+
+		zassert_true(e->producer < NUM_PRODUCERS);
+		zassert_equal(e->seq, ctx->read_cnt[e->producer],
+			      "producer %d: got %d, expected %d", e->producer,
+			      e->seq, ctx->read_cnt[e->producer]);
+		zassert_equal(e->data, ~(uint32_t)e->seq);
+		ctx->read_cnt[e->producer]++;
+		ctx->reads++;
+
+		mpsc_ring_free(&ctx->ring, e);
+	}
+
+	return true;
+}
+
+static bool stress_write(void *user_data, uint32_t cnt, bool last, int prio)
+{
+	struct stress_data *ctx = user_data;
+	int rpt = (sys_rand32_get() & 3) + 1;
+	struct elem *e;
+
+	for (int i = 0; i < rpt; i++) {
+		e = mpsc_ring_put_claim(&ctx->ring);
+		if (e == NULL) {
+			ctx->wr_err++;
+			return true;
+		}
+
+		e->producer = prio;
+		e->seq = ctx->write_cnt[prio]++;
+		e->data = ~(uint32_t)e->seq;
+		mpsc_ring_put_commit(&ctx->ring, e);
+	}
+
+	return true;
+}
+
+/* Two producers of different priorities and a consumer preempting each
+ * other; elements of each producer are read in order and intact.
+ */
+ZTEST(mpsc_ring, test_stress)
+{
+	static struct stress_data ctx;
+
+	mpsc_ring_init(&ctx.ring, ctx.buf, ctx.seq, sizeof(ctx.buf[0]),
+		       ARRAY_SIZE(ctx.buf), 0);
+
+	ztress_set_timeout(K_MSEC(STRESS_TIMEOUT_MS));
+	ZTRESS_EXECUTE(ZTRESS_TIMER(stress_write, &ctx, 0, Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(stress_write, &ctx, 0, 2000, Z_TIMEOUT_TICKS(4)),
+		       ZTRESS_THREAD(stress_read, &ctx, 0, 1000, Z_TIMEOUT_TICKS(4)));
+
+	/* Whatever is left over is still in order, and nothing is lost */
+	while (mpsc_ring_is_pending(&ctx.ring)) {
+		stress_read(&ctx, 0, true, 0);
+	}
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		zassert_equal(ctx.read_cnt[i], ctx.write_cnt[i]);
+	}
+
+	TC_PRINT("Reads: %u, full: %u\n", ctx.reads, ctx.wr_err);
+	zassert_true(ctx.reads > 0);
+}
+
+ZTEST_SUITE(mpsc_ring, NULL, NULL, NULL, NULL, NULL);
@@ -272,6 +272,93 @@ ZTEST(coap, test_parse_simple_pdu)
 		      "There shouldn't be any ETAG option in the packet");
 }
 
+ZTEST(coap, test_find_options_after_parse)
+{
+	struct coap_packet cpkt;
+	struct coap_option options[20];
+	uint8_t *data = data_buf[0];
+	char query[] = "q=00";
+	int count;
+	int r;
+	int i;
+
+	r = coap_packet_init(&cpkt, data, COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_CON, 0, NULL, COAP_METHOD_GET, 0x1234);
+	zassert_equal(r, 0, "Could not initialize packet");
+
+	r = coap_append_option_int(&cpkt, COAP_OPTION_OBSERVE, 0);
+	zassert_equal(r, 0, "Could not append option");
+
+	r = coap_packet_append_option(&cpkt, COAP_OPTION_URI_PATH, "a", 1);
+	zassert_equal(r, 0, "Could not append option");
+
+	r = coap_packet_append_option(&cpkt, COAP_OPTION_URI_PATH, "bc", 2);
+	zassert_equal(r, 0, "Could not append option");
+
+	r = coap_append_option_int(&cpkt, COAP_OPTION_BLOCK2, 0x16);
+	zassert_equal(r, 0, "Could not append option");
+
+	r = coap_packet_parse(&cpkt, data, cpkt.offset, NULL, 0);
+	zassert_equal(r, 0, "Could not parse packet");
+
+	count = coap_find_options(&cpkt, COAP_OPTION_URI_PATH, options, 4);
+	zassert_equal(count, 2, "Wrong number of Uri-Path options");
+	zassert_equal(options[0].delta, COAP_OPTION_URI_PATH, "Wrong option");
+	zassert_mem_equal(options[0].value, "a", 1, "Wrong option value");
+	zassert_equal(options[1].len, 2, "Wrong option length");
+	zassert_mem_equal(options[1].value, "bc", 2, "Wrong option value");
+
+	count = coap_find_options(&cpkt, COAP_OPTION_URI_PATH, options, 1);
+	zassert_equal(count, 1, "Option vector length not respected");
+
+	zassert_equal(coap_get_option_int(&cpkt, COAP_OPTION_OBSERVE), 0,
+		      "Wrong Observe option");
+	zassert_equal(coap_get_option_int(&cpkt, COAP_OPTION_BLOCK2), 0x16,
+		      "Wrong Block2 option");
+	zassert_equal(coap_get_option_int(&cpkt, COAP_OPTION_ACCEPT), -ENOENT,
+		      "Accept option should not be found");
+
+	/* Options added to a parsed packet must be found as well */
+	cpkt.max_len = COAP_BUF_SIZE;
+	r = coap_append_option_int(&cpkt, COAP_OPTION_CONTENT_FORMAT,
+				   COAP_CONTENT_FORMAT_APP_CBOR);
+	zassert_equal(r, 0, "Could not insert option");
+
+	zassert_equal(coap_get_option_int(&cpkt, COAP_OPTION_CONTENT_FORMAT),
+		      COAP_CONTENT_FORMAT_APP_CBOR, "Wrong Content-Format option");
+	zassert_equal(coap_get_option_int(&cpkt, COAP_OPTION_BLOCK2), 0x16,
+		      "Wrong Block2 option");
+
+	/* More options than there is room for in the option index */
+	r = coap_packet_init(&cpkt, data, COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_CON, 0, NULL, COAP_METHOD_GET, 0x1234);
+	zassert_equal(r, 0, "Could not initialize packet");
+
+	for (i = 0; i < ARRAY_SIZE(options); i++) {
+		query[2] = '0' + i / 10;
+		query[3] = '0' + i % 10;
+
+		r = coap_packet_append_option(&cpkt, COAP_OPTION_URI_QUERY,
+					      query, strlen(query));
+		zassert_equal(r, 0, "Could not append option");
+	}
+
+	r = coap_append_option_int(&cpkt, COAP_OPTION_SIZE1, 1024);
+	zassert_equal(r, 0, "Could not append option");
+
+	r = coap_packet_parse(&cpkt, data, cpkt.offset, NULL, 0);
+	zassert_equal(r, 0, "Could not parse packet");
+
+	count = coap_find_options(&cpkt, COAP_OPTION_URI_QUERY, options,
+				  ARRAY_SIZE(options));
+	zassert_equal(count, ARRAY_SIZE(options),
+		      "Wrong number of Uri-Query options");
+	zassert_mem_equal(options[ARRAY_SIZE(options) - 1].value, "q=19", 4,
+			  "Wrong option value");
+	zassert_equal(coap_get_option_int(&cpkt, COAP_OPTION_SIZE1), 1024,
+		      "Wrong Size1 option");
+}
+
 ZTEST(coap, test_parse_malformed_pkt)
 {
 	uint8_t opt[] = { 0x55, 0xA5, 0x12 };
@@ -1023,6 +1110,198 @@ ZTEST(coap, test_handle_invalid_coap_req)
 	zassert_equal(r, -ENOTSUP, "Request handling should fail with -ENOTSUP");
 }
 
+static struct coap_resource *router_called;
+
+static int router_resource_get(struct coap_resource *resource,
+			       struct coap_packet *request,
+			       struct sockaddr *addr, socklen_t addr_len)
+{
+	router_called = resource;
+
+	return 0;
+}
+
+static const char * const router_path_temp[] = { "sensors", "temp", NULL };
+static const char * const router_path_any[] = { "sensors", "+", NULL };
+static const char * const router_path_value[] = { "sensors", "+", "value", NULL };
+static const char * const router_path_all[] = { "sensors", "#", NULL };
+static const char * const router_path_led[] = { "actuators", "led", NULL };
+static const char * const router_path_any_led[] = { "+", "led", NULL };
+static const char * const router_path_sensors[] = { "sensors", NULL };
+
+static struct coap_resource router_resources[] = {
+	{ .path = router_path_temp, .get = router_resource_get },
+	{ .path = router_path_any, .get = router_resource_get },
+	{ .path = router_path_value, .get = router_resource_get },
+	{ .path = router_path_all, .get = router_resource_get },
+	{ .path = router_path_led, .get = router_resource_get },
+	{ .path = router_path_any_led, .get = router_resource_get },
+	{ .path = router_path_sensors },
+	{ },
+};
+
+static void router_request(struct coap_packet *cpkt, struct coap_option *options,
+			   uint8_t *opt_num, const char *uri)
+{
+	const char *segment = uri;
+	int r;
+
+	r = coap_packet_init(cpkt, data_buf[0], COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_CON, 0, NULL, COAP_METHOD_GET,
+			     coap_next_id());
+	zassert_equal(r, 0, "Unable to init req");
+
+	r = coap_append_option_int(cpkt, COAP_OPTION_OBSERVE, 0);
+	zassert_equal(r, 0, "Unable to add option");
+
+	while (*segment) {
+		size_t len = strcspn(segment, "/");
+
+		r = coap_packet_append_option(cpkt, COAP_OPTION_URI_PATH,
+					      segment, len);
+		zassert_equal(r, 0, "Unable to append option");
+
+		segment += len;
+		segment += *segment == '/';
+	}
+
+	r = coap_append_option_int(cpkt, COAP_OPTION_ACCEPT,
+				   COAP_CONTENT_FORMAT_TEXT_PLAIN);
+	zassert_equal(r, 0, "Unable to add option");
+
+	r = coap_packet_parse(cpkt, data_buf[0], cpkt->offset, options, *opt_num);
+	zassert_true(r == 0, "Could not parse req packet");
+
+	*opt_num = r == 0 ? *opt_num : 0;
+}
+
+ZTEST(coap, test_router)
+{
+	static const struct {
+		const char *uri;
+		int resource;
+	} requests[] = {
+		{ "sensors/temp", 0 },
+		{ "sensors/hum", 1 },
+		{ "sensors/hum/value", 2 },
+		{ "sensors/temp/value", 2 },
+		{ "sensors/hum/x/y", 3 },
+		{ "actuators/led", 4 },
+		{ "lights/led", 5 },
+		{ "sensors", 6 },
+		{ "actuators", -1 },
+		{ "sensors/temp/led", 3 },
+		{ "led", -1 },
+	};
+	struct coap_router_node nodes[8];
+	struct coap_router router;
+	struct coap_option options[8];
+	struct coap_resource *expected, *handler;
+	struct coap_packet req;
+	uint8_t opt_num;
+	int r_linear, r;
+	int i;
+
+	r = coap_router_init(&router, router_resources, nodes, 5);
+	zassert_equal(r, -ENOMEM, "Router should run out of nodes");
+
+	r = coap_router_init(&router, router_resources, nodes, ARRAY_SIZE(nodes));
+	zassert_equal(r, 0, "Could not initialize router");
+
+	for (i = 0; i < ARRAY_SIZE(requests); i++) {
+		opt_num = ARRAY_SIZE(options);
+		router_request(&req, options, &opt_num, requests[i].uri);
+
+		expected = requests[i].resource < 0 ? NULL :
+			   &router_resources[requests[i].resource];
+		handler = expected && expected->get ? expected : NULL;
+
+		zassert_equal_ptr(coap_router_lookup(&router, options, opt_num),
+				  expected, "Wrong resource for %s",
+				  requests[i].uri);
+
+		/* Same result as with the linear search */
+		router_called = NULL;
+		r_linear = coap_handle_request(&req, router_resources, options,
+					       opt_num,
+					       (struct sockaddr *)&dummy_addr,
+					       sizeof(dummy_addr));
+		zassert_equal_ptr(router_called, handler,
+				  "Linear search differs for %s",
+				  requests[i].uri);
+
+		router_called = NULL;
+		r = coap_router_handle_request(&router, &req, options, opt_num,
+					       (struct sockaddr *)&dummy_addr,
+					       sizeof(dummy_addr));
+		zassert_equal(r, r_linear, "Wrong result for %s",
+			      requests[i].uri);
+		zassert_equal_ptr(router_called, handler,
+				  "Wrong handler called for %s",
+				  requests[i].uri);
+	}
+}
+
+static const char * const overlap_path_0[] = { "a", "b", "c", NULL };
+static const char * const overlap_path_1[] = { "+", "b", "+", NULL };
+static const char * const overlap_path_2[] = { "a", "+", "c", NULL };
+static const char * const overlap_path_3[] = { "+", "+", "+", NULL };
+static const char * const overlap_path_4[] = { "+", "+", "c", NULL };
+
+static struct coap_resource overlap_resources[] = {
+	{ .path = overlap_path_0, .get = router_resource_get },
+	{ .path = overlap_path_1, .get = router_resource_get },
+	{ .path = overlap_path_2, .get = router_resource_get },
+	{ .path = overlap_path_3, .get = router_resource_get },
+	{ .path = overlap_path_4, .get = router_resource_get },
+	{ },
+};
+
+ZTEST(coap, test_router_overlapping_wildcards)
+{
+	static const struct {
+		const char *uri;
+		int resource;
+	} requests[] = {
+		{ "a/b/c", 0 },
+		{ "x/b/c", 1 },
+		{ "a/x/c", 2 },
+		{ "x/x/x", 3 },
+		{ "a/b/x", 1 },
+		{ "x/x/c", 3 },
+		{ "a/b", -1 },
+		{ "a/b/c/d", -1 },
+	};
+	struct coap_router_node nodes[16];
+	struct coap_router router;
+	struct coap_option options[8];
+	struct coap_packet req;
+	uint8_t opt_num;
+	int r;
+	int i;
+
+	/* Four distinct patterns at the last level, the fifth one is too much */
+	overlap_resources[4].path = NULL;
+
+	r = coap_router_init(&router, overlap_resources, nodes, ARRAY_SIZE(nodes));
+	zassert_equal(r, 0, "Could not initialize router");
+
+	for (i = 0; i < ARRAY_SIZE(requests); i++) {
+		opt_num = ARRAY_SIZE(options);
+		router_request(&req, options, &opt_num, requests[i].uri);
+
+		zassert_equal_ptr(coap_router_lookup(&router, options, opt_num),
+				  requests[i].resource < 0 ? NULL :
+				  &overlap_resources[requests[i].resource],
+				  "Wrong resource for %s", requests[i].uri);
+	}
+
+	overlap_resources[4].path = overlap_path_4;
+
+	r = coap_router_init(&router, overlap_resources, nodes, ARRAY_SIZE(nodes));
+	zassert_equal(r, -E2BIG, "Too many overlapping paths accepted");
+}
+
 ZTEST(coap, test_build_options_out_of_order_0)
 {
 	uint8_t result[] = {0x45, 0x02, 0x12, 0x34, 't', 'o', 'k',  'e', 'n', 0xC0, 0xB1, 0x19,
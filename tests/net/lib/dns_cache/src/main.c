@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <dns_pack.h>
+#include <dns_internal.h>
+
+#define DNAME1 "www.zephyrproject.org"
+#define DNAME2 "www.wireshark.org"
+#define DNAME3 "zephyrproject.org"
+
+#define TIMEOUT_MS 1000
+
+static struct dns_resolve_context dns_ctx;
+static struct dns_resolve_context other_ctx;
+
+/* Labels of DNAME1 and query type A, used to calculate the query hash */
+static const uint8_t query_hash_data[] = {
+	0x03, 0x77, 0x77, 0x77, 0x0d, 0x7a, 0x65, 0x70,
+	0x68, 0x79, 0x72, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+	0x63, 0x74, 0x03, 0x6f, 0x72, 0x67, 0x00,
+	0x00, 0x01
+};
+
+/* Answer to DNAME1 with transaction ID 0xb041, TTL 3028 and address
+ * 140.211.169.8
+ */
+static uint8_t resp_ipv4[] = { 0xb0, 0x41, 0x81, 0x80, 0x00, 0x01, 0x00, 0x01,
+			       0x00, 0x00, 0x00, 0x00, 0x03, 0x77, 0x77, 0x77,
+			       0x0d, 0x7a, 0x65, 0x70, 0x68, 0x79, 0x72, 0x70,
+			       0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x03, 0x6f,
+			       0x72, 0x67, 0x00, 0x00, 0x01, 0x00, 0x01, 0xc0,
+			       0x0c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0b,
+			       0xd4, 0x00, 0x04, 0x8c, 0xd3, 0xa9, 0x08 };
+
+static const struct in_addr resp_ipv4_addr = { { { 140, 211, 169, 8 } } };
+
+/* NODATA answer to DNAME1 with transaction ID 0xb041: no error, no answer
+ * and the SOA record of zephyrproject.org in the authority section
+ */
+static uint8_t resp_nodata[] = { 0xb0, 0x41, 0x81, 0x80, 0x00, 0x01, 0x00, 0x00,
+				 0x00, 0x01, 0x00, 0x00, 0x03, 0x77, 0x77, 0x77,
+				 0x0d, 0x7a, 0x65, 0x70, 0x68, 0x79, 0x72, 0x70,
+				 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x03, 0x6f,
+				 0x72, 0x67, 0x00, 0x00, 0x01, 0x00, 0x01, 0xc0,
+				 0x10, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x0e,
+				 0x10, 0x00, 0x18, 0xc0, 0x10, 0xc0, 0x10, 0x00,
+				 0x00, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x10, 0x00,
+				 0x00, 0x07, 0x08, 0x00, 0x09, 0x3a, 0x80, 0x00,
+				 0x00, 0x0e, 0x10 };
+
+struct result {
+	int addresses;
+	int status;
+};
+
+static void resolve_cb(enum dns_resolve_status status,
+		       struct dns_addrinfo *info,
+		       void *user_data)
+{
+	struct result *result = user_data;
+
+	if (status == DNS_EAI_INPROGRESS) {
+		zassert_equal(info->ai_family, AF_INET, "Wrong family");
+		zassert_true(net_ipv4_addr_cmp(&net_sin(&info->ai_addr)->sin_addr,
+					       &resp_ipv4_addr),
+			     "Wrong address");
+		result->addresses++;
+		return;
+	}
+
+	result->status = status;
+}
+
+static void setup_query(int idx, uint16_t dns_id, struct result *result)
+{
+	memset(result, 0, sizeof(*result));
+
+	dns_ctx.queries[idx].cb = resolve_cb;
+	dns_ctx.queries[idx].user_data = result;
+	dns_ctx.queries[idx].id = dns_id;
+	dns_ctx.queries[idx].query = DNAME1;
+	dns_ctx.queries[idx].query_type = DNS_QUERY_TYPE_A;
+	dns_ctx.queries[idx].query_hash = crc16_ansi(query_hash_data,
+						     sizeof(query_hash_data));
+	dns_ctx.queries[idx].primary = -1;
+	dns_ctx.queries[idx].ctx = &dns_ctx;
+}
+
+static int validate(uint8_t *msg, size_t len)
+{
+	struct dns_msg_t dns_msg = { 0 };
+	uint16_t dns_id = 0;
+	uint16_t query_hash = 0;
+	int query_idx = -1;
+
+	dns_msg.msg = msg;
+	dns_msg.msg_size = len;
+
+	return dns_validate_msg(&dns_ctx, &dns_msg, &dns_id, &query_idx,
+				NULL, &query_hash);
+}
+
+static void resolve(const char *name, struct result *result)
+{
+	uint16_t dns_id = 0xffff;
+
+	memset(result, 0, sizeof(*result));
+
+	zassert_equal(dns_resolve_name(&dns_ctx, name, DNS_QUERY_TYPE_A,
+				       &dns_id, resolve_cb, result,
+				       TIMEOUT_MS), 0,
+		      "Cached answer not used");
+	zassert_not_equal(result->status, 0, "Callback not called");
+	zassert_equal(dns_id, 0, "Cached answer has a DNS id");
+}
+
+ZTEST(dns_cache, test_answer_cached)
+{
+	struct dns_msg_t dns_msg = { 0 };
+	struct result first, second;
+	struct dns_cache_stats stats;
+	uint32_t hits;
+	uint16_t dns_id = 0;
+	uint16_t query_hash = 0;
+	int query_idx = -1;
+	int ret;
+
+	/* Two queries for the same name share the answer */
+	setup_query(0, 0xb041, &first);
+	setup_query(1, 0x1234, &second);
+	dns_ctx.queries[1].primary = 0;
+
+	dns_msg.msg = resp_ipv4;
+	dns_msg.msg_size = sizeof(resp_ipv4);
+
+	ret = dns_validate_msg(&dns_ctx, &dns_msg, &dns_id, &query_idx,
+			       NULL, &query_hash);
+	zassert_equal(ret, DNS_EAI_ALLDONE, "DNS message failed (%d)", ret);
+	zassert_equal(query_idx, 0, "Wrong query slot");
+	zassert_equal(first.addresses, 1, "Answer not given");
+	zassert_equal(second.addresses, 1, "Answer not shared");
+
+	dns_cache_get_stats(&stats);
+	zassert_equal(stats.entries, 1, "Answer not cached");
+
+	resolve(DNAME1, &first);
+	zassert_equal(first.addresses, 1, "Cached address not given");
+	zassert_equal(first.status, DNS_EAI_ALLDONE, "Wrong status");
+
+	hits = stats.hits;
+	dns_cache_get_stats(&stats);
+	zassert_equal(stats.hits, hits + 1, "Hit not counted");
+}
+
+ZTEST(dns_cache, test_nodata_cached)
+{
+	struct sockaddr addr;
+	struct result result;
+	int ret;
+
+	setup_query(0, 0xb041, &result);
+
+	ret = validate(resp_nodata, sizeof(resp_nodata));
+	zassert_equal(ret, DNS_EAI_NODATA, "DNS message failed (%d)", ret);
+
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				     &addr, 1), 0, "NODATA not cached");
+
+	resolve(DNAME1, &result);
+	zassert_equal(result.addresses, 0, "Address given");
+	zassert_equal(result.status, DNS_EAI_NODATA, "Wrong status");
+}
+
+ZTEST(dns_cache, test_nodata_soa_ttl)
+{
+	uint8_t msg[sizeof(resp_nodata)];
+	struct sockaddr addr;
+	struct result result;
+	int ret;
+
+	/* The SOA MINIMUM of one second is less than its TTL */
+	memcpy(msg, resp_nodata, sizeof(msg));
+	sys_put_be32(1, &msg[sizeof(msg) - sizeof(uint32_t)]);
+
+	setup_query(0, 0xb041, &result);
+
+	ret = validate(msg, sizeof(msg));
+	zassert_equal(ret, DNS_EAI_NODATA, "DNS message failed (%d)", ret);
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				     &addr, 1), 0, "NODATA not cached");
+
+	k_msleep(MSEC_PER_SEC + 100);
+
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				     &addr, 1), -ENOENT,
+		      "SOA MINIMUM not used");
+
+	/* Without a SOA record in the authority section the configured TTL
+	 * is used. Turn the record into a NS record (type 2).
+	 */
+	sys_put_be16(2,
+		     &msg[DNS_MSG_HEADER_SIZE + sizeof(query_hash_data) + 2 + 2]);
+	setup_query(0, 0xb041, &result);
+
+	ret = validate(msg, sizeof(msg));
+	zassert_equal(ret, DNS_EAI_NODATA, "DNS message failed (%d)", ret);
+
+	k_msleep(MSEC_PER_SEC + 100);
+
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				     &addr, 1), 0, "NODATA not cached");
+}
+
+ZTEST(dns_cache, test_cache_per_context)
+{
+	struct sockaddr addr = { .sa_family = AF_INET };
+
+	dns_cache_add(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1, 60);
+
+	zassert_equal(dns_cache_find(&other_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				     &addr, 1), -ENOENT,
+		      "Answer of another context used");
+
+	dns_cache_flush_ctx(&other_ctx);
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				     &addr, 1), 1,
+		      "Answer removed with another context");
+
+	dns_cache_flush_ctx(&dns_ctx);
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				     &addr, 1), -ENOENT,
+		      "Answer not removed with its context");
+}
+
+ZTEST(dns_cache, test_coalesced_rehomed)
+{
+	struct result first, second, third;
+	uint16_t first_id, second_id, third_id;
+
+	/* The first query has no server to go to, but is pending */
+	zassert_equal(dns_resolve_name(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				       &first_id, resolve_cb, &first,
+				       TIMEOUT_MS), 0, "Query failed");
+	zassert_equal(dns_resolve_name(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				       &second_id, resolve_cb, &second,
+				       TIMEOUT_MS), 0, "Query failed");
+	zassert_equal(dns_ctx.queries[1].primary, 0, "Query not coalesced");
+
+	/* Canceling the first query leaves the second one waiting for an
+	 * answer of its own.
+	 */
+	memset(&first, 0, sizeof(first));
+	memset(&second, 0, sizeof(second));
+	zassert_ok(dns_resolve_cancel(&dns_ctx, first_id), "Cancel failed");
+
+	zassert_equal(first.status, DNS_EAI_CANCELED, "Not canceled");
+	zassert_equal(second.status, 0, "Coalesced query completed");
+	zassert_equal(dns_ctx.queries[1].primary, -1, "Query not rehomed");
+
+	/* A new query is coalesced with the live one, not the released one */
+	zassert_equal(dns_resolve_name(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A,
+				       &third_id, resolve_cb, &third,
+				       TIMEOUT_MS), 0, "Query failed");
+	zassert_equal(dns_ctx.queries[0].primary, 1, "Query not coalesced");
+
+	/* The answer to the new primary is given to both */
+	memset(&third, 0, sizeof(third));
+	sys_put_be16(second_id, resp_ipv4);
+	dns_ctx.queries[1].query_hash = crc16_ansi(query_hash_data,
+						   sizeof(query_hash_data));
+	zassert_equal(validate(resp_ipv4, sizeof(resp_ipv4)),
+		      DNS_EAI_ALLDONE, "DNS message failed");
+	sys_put_be16(0xb041, resp_ipv4);
+
+	zassert_equal(second.addresses, 1, "Answer not given");
+	zassert_equal(third.addresses, 1, "Answer not shared");
+
+	zassert_ok(dns_resolve_cancel(&dns_ctx, second_id), "Cancel failed");
+	zassert_equal(third.status, 0, "Coalesced query completed");
+	zassert_ok(dns_resolve_cancel(&dns_ctx, third_id), "Cancel failed");
+}
+
+ZTEST(dns_cache, test_negative_answer)
+{
+	struct sockaddr addr;
+	struct result result;
+
+	dns_cache_add(&dns_ctx, DNAME2, DNS_QUERY_TYPE_A, NULL, 0,
+		      CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL);
+
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME2, DNS_QUERY_TYPE_A, &addr, 1), 0,
+		      "Negative answer not cached");
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME2, DNS_QUERY_TYPE_AAAA, &addr, 1),
+		      -ENOENT, "Wrong query type matched");
+
+	resolve(DNAME2, &result);
+	zassert_equal(result.addresses, 0, "Address given");
+	zassert_equal(result.status, DNS_EAI_NODATA, "Wrong status");
+}
+
+ZTEST(dns_cache, test_ttl_expires)
+{
+	struct sockaddr addr = { .sa_family = AF_INET };
+
+	dns_cache_add(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1, 1);
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1), 1,
+		      "Answer not cached");
+
+	k_msleep(MSEC_PER_SEC + 100);
+
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1),
+		      -ENOENT, "Expired answer used");
+
+	/* Answers with zero TTL must not be cached at all */
+	dns_cache_add(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1, 0);
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1),
+		      -ENOENT, "Zero TTL answer cached");
+}
+
+ZTEST(dns_cache, test_lru_eviction)
+{
+	struct sockaddr addr = { .sa_family = AF_INET };
+
+	BUILD_ASSERT(CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES == 2);
+
+	dns_cache_add(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1, 60);
+	dns_cache_add(&dns_ctx, DNAME2, DNS_QUERY_TYPE_A, &addr, 1, 60);
+
+	/* Using the first answer makes the second one least recently used */
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1), 1,
+		      "Answer not cached");
+
+	dns_cache_add(&dns_ctx, DNAME3, DNS_QUERY_TYPE_A, &addr, 1, 60);
+
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, &addr, 1), 1,
+		      "Recently used answer dropped");
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME2, DNS_QUERY_TYPE_A, &addr, 1),
+		      -ENOENT, "Least recently used answer kept");
+	zassert_equal(dns_cache_find(&dns_ctx, DNAME3, DNS_QUERY_TYPE_A, &addr, 1), 1,
+		      "Answer not cached");
+}
+
+static void cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(&dns_ctx, 0, sizeof(dns_ctx));
+	k_mutex_init(&dns_ctx.lock);
+	dns_ctx.state = DNS_RESOLVE_CONTEXT_ACTIVE;
+	dns_cache_flush();
+}
+
+ZTEST_SUITE(dns_cache, NULL, NULL, cache_before, NULL, NULL);
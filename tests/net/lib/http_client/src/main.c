@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/net/http/client.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/ztest.h>
+
+#define TIMEOUT_MS 1000
+
+static int sv[2];
+static uint8_t recv_buf[256];
+
+/* Response as seen by the final response callback */
+static uint16_t status_code;
+static bool keep_alive;
+static char body[64];
+static size_t body_len;
+static struct http_response_timing timing;
+
+/* Server side of the connections opened by http_client_conn_req(), and the
+ * response it queues when a connection is opened.
+ */
+static int conn_server = -1;
+static const char *conn_response;
+
+static void response_cb(struct http_response *rsp,
+			enum http_final_call final_data, void *user_data)
+{
+	if (rsp->body_frag_start != NULL) {
+		zassert_true(body_len + rsp->body_frag_len <= sizeof(body),
+			     "Body too long");
+		memcpy(&body[body_len], rsp->body_frag_start,
+		       rsp->body_frag_len);
+		body_len += rsp->body_frag_len;
+	}
+
+	if (final_data == HTTP_DATA_FINAL) {
+		status_code = rsp->http_status_code;
+		keep_alive = rsp->keep_alive;
+		timing = rsp->timing;
+	}
+}
+
+static void sock_send(int sock, const char *data)
+{
+	zassert_equal(zsock_send(sock, data, strlen(data), 0), strlen(data),
+		      "Cannot queue response");
+}
+
+static void server_send(const char *data)
+{
+	sock_send(sv[1], data);
+}
+
+static void request_init(struct http_request *req, enum http_method method,
+			 size_t recv_len)
+{
+	memset(req, 0, sizeof(*req));
+
+	req->method = method;
+	req->url = "/";
+	req->host = "localhost";
+	req->protocol = "HTTP/1.1";
+	req->response = response_cb;
+	req->recv_buf = recv_buf;
+	req->recv_buf_len = recv_len;
+
+	status_code = 0;
+	keep_alive = false;
+	body_len = 0;
+	memset(&timing, 0, sizeof(timing));
+}
+
+static void do_request(enum http_method method, size_t recv_len)
+{
+	struct http_request req;
+
+	request_init(&req, method, recv_len);
+
+	zassert_true(http_client_req(sv[0], &req, TIMEOUT_MS, NULL) > 0,
+		     "Request failed");
+}
+
+static int conn_connect(struct http_client_conn *conn, void *user_data)
+{
+	int pair[2];
+
+	/* Only one connection is open at a time */
+	if (conn_server >= 0) {
+		zsock_close(conn_server);
+	}
+
+	zassert_equal(zsock_socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0,
+		      "socketpair failed");
+
+	conn_server = pair[1];
+	sock_send(conn_server, conn_response);
+
+	return pair[0];
+}
+
+static void do_conn_request(struct http_client_conn *conn)
+{
+	struct http_request req;
+
+	request_init(&req, HTTP_GET, sizeof(recv_buf));
+
+	zassert_true(http_client_conn_req(conn, &req, TIMEOUT_MS, NULL) > 0,
+		     "Request failed");
+	zassert_equal(status_code, 200, "Wrong status");
+}
+
+static void client_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(zsock_socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0,
+		      "socketpair failed");
+}
+
+static void client_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zsock_close(sv[0]);
+	zsock_close(sv[1]);
+
+	if (conn_server >= 0) {
+		zsock_close(conn_server);
+		conn_server = -1;
+	}
+}
+
+ZTEST(http_client, test_keep_alive)
+{
+	server_send("HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello");
+	do_request(HTTP_GET, sizeof(recv_buf));
+
+	zassert_equal(status_code, 200, "Wrong status");
+	zassert_true(keep_alive, "Connection not reusable");
+	zassert_equal(body_len, 5, "Wrong body length");
+	zassert_mem_equal(body, "hello", 5, "Wrong body");
+
+	/* The same connection serves the next request */
+	server_send("HTTP/1.1 200 OK\r\nContent-Length: 5\r\n"
+		    "Connection: close\r\n\r\nworld");
+	do_request(HTTP_GET, sizeof(recv_buf));
+
+	zassert_equal(status_code, 200, "Wrong status");
+	zassert_false(keep_alive, "Connection: close ignored");
+	zassert_mem_equal(body, "world", 5, "Wrong body");
+}
+
+ZTEST(http_client, test_skipped_body_consumed)
+{
+	static const char headers[] =
+		"HTTP/1.1 503 Service Unavailable\r\nContent-Length: 4\r\n\r\n";
+
+	/* The body arrives in a receive call of its own */
+	server_send(headers);
+	server_send("busy");
+	do_request(HTTP_GET, sizeof(headers) - 1);
+
+	zassert_equal(status_code, 503, "Wrong status");
+	zassert_equal(body_len, 0, "Error body delivered");
+
+	/* Nothing of the error body is left for the next response */
+	server_send("HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello");
+	do_request(HTTP_GET, sizeof(recv_buf));
+
+	zassert_equal(status_code, 200, "Stream out of sync");
+	zassert_mem_equal(body, "hello", 5, "Wrong body");
+}
+
+ZTEST(http_client, test_head_without_length)
+{
+	int64_t start = k_uptime_get();
+
+	server_send("HTTP/1.1 200 OK\r\n\r\n");
+	do_request(HTTP_HEAD, sizeof(recv_buf));
+
+	zassert_equal(status_code, 200, "Wrong status");
+	zassert_true(keep_alive, "Connection not reusable");
+	zassert_true(k_uptime_get() - start < TIMEOUT_MS,
+		     "Waited for a body that cannot come");
+}
+
+ZTEST(http_client, test_conn_reuse)
+{
+	struct http_client_conn conn;
+
+	http_client_conn_init(&conn, conn_connect);
+
+	conn_response = "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+	do_conn_request(&conn);
+
+	zassert_true(conn.sock >= 0, "Connection not kept");
+	zassert_equal(conn.connections, 1, "Wrong number of connections");
+
+	/* The server asks to close the connection after this response */
+	sock_send(conn_server, "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n"
+		  "Connection: close\r\n\r\nworld");
+	do_conn_request(&conn);
+
+	zassert_mem_equal(body, "world", 5, "Wrong body");
+	zassert_equal(conn.connections, 1, "Connection not reused");
+	zassert_equal(conn.sock, -1, "Connection: close ignored");
+
+	do_conn_request(&conn);
+
+	zassert_mem_equal(body, "hello", 5, "Wrong body");
+	zassert_equal(conn.requests, 3, "Wrong number of requests");
+	zassert_equal(conn.connections, 2, "Connection not reopened");
+
+	http_client_conn_close(&conn);
+	zassert_equal(conn.sock, -1, "Connection not closed");
+}
+
+ZTEST(http_client, test_conn_closed_by_server)
+{
+	struct http_client_conn conn;
+
+	http_client_conn_init(&conn, conn_connect);
+
+	conn_response = "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+	do_conn_request(&conn);
+
+	/* The server drops the idle connection, the request goes to a new one */
+	zsock_close(conn_server);
+	conn_server = -1;
+
+	do_conn_request(&conn);
+
+	zassert_mem_equal(body, "hello", 5, "Wrong body");
+	zassert_equal(conn.requests, 3, "Request not sent again");
+	zassert_equal(conn.connections, 2, "Connection not reopened");
+
+	http_client_conn_close(&conn);
+}
+
+ZTEST(http_client, test_conn_closed_post_not_resent)
+{
+	struct http_client_conn conn;
+	struct http_request req;
+
+	http_client_conn_init(&conn, conn_connect);
+
+	conn_response = "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+	do_conn_request(&conn);
+
+	/* The server may have processed the POST before closing */
+	zsock_close(conn_server);
+	conn_server = -1;
+
+	request_init(&req, HTTP_POST, sizeof(recv_buf));
+	zassert_true(http_client_conn_req(&conn, &req, TIMEOUT_MS, NULL) < 0,
+		     "Lost connection not reported");
+
+	zassert_equal(conn.requests, 2, "POST sent again");
+	zassert_equal(conn.connections, 1, "Connection reopened");
+	zassert_equal(conn.sock, -1, "Lost connection kept");
+}
+
+ZTEST(http_client, test_timing)
+{
+	struct http_client_conn conn;
+	struct http_request req;
+
+	http_client_conn_init(&conn, conn_connect);
+
+	conn_response = "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+	do_conn_request(&conn);
+
+	zassert_true(timing.connected <= timing.sent, "Wrong timing");
+	zassert_true(timing.sent <= timing.first_byte, "Wrong timing");
+	zassert_true(timing.first_byte <= timing.done, "Wrong timing");
+	zassert_true(timing.done < TIMEOUT_MS, "Wrong timing");
+
+	/* Without a response, the request is done when the wait times out */
+	request_init(&req, HTTP_GET, sizeof(recv_buf));
+	zassert_true(http_client_conn_req(&conn, &req, 100, NULL) > 0,
+		     "Request failed");
+
+	zassert_equal(status_code, 0, "Unexpected response");
+	zassert_true(timing.done >= 100, "Timeout not in timing");
+	zassert_equal(conn.sock, -1, "Incomplete connection kept");
+}
+
+ZTEST_SUITE(http_client, NULL, NULL, client_before, client_after, NULL);
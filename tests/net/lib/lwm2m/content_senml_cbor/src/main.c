@@ -7,6 +7,8 @@
 #include <zephyr/kernel.h>
 #include <zephyr/ztest.h>
 
+#include <zcbor_decode.h>
+
 #include "lwm2m_util.h"
 #include "lwm2m_rw_senml_cbor.h"
 #include "lwm2m_engine.h"
@@ -955,6 +957,136 @@ ZTEST(net_content_senml_cbor_nomem, test_put_time_nomem)
 	zassert_equal(ret, -ENOMEM, "Invalid error code returned");
 }
 
+/* More records than the decoder can hold, with a two byte array header */
+#define TEST_RECORD_COUNT (CONFIG_LWM2M_RW_SENML_CBOR_RECORDS + 2)
+#define TEST_RECORD_LEN 17
+
+BUILD_ASSERT(TEST_RECORD_COUNT >= 24, "Two byte array header not covered");
+
+static struct lwm2m_obj_path_list test_path_list_buf[TEST_RECORD_COUNT];
+
+static void test_path_list_init(sys_slist_t *path_list, int count)
+{
+	sys_slist_init(path_list);
+
+	for (int i = 0; i < count; i++) {
+		test_path_list_buf[i].path = LWM2M_OBJ(TEST_OBJ_ID, TEST_OBJ_INST_ID,
+						       i % 2 ? TEST_RES_S16 : TEST_RES_S8);
+		sys_slist_append(path_list, &test_path_list_buf[i].node);
+	}
+}
+
+/* Decode the payload, to check that it is a single well-formed array */
+static void test_senml_array_decode(const uint8_t *payload, size_t len, int count)
+{
+	zcbor_state_t states[3];
+
+	zcbor_new_decode_state(states, ARRAY_SIZE(states), payload, len, 1);
+
+	zassert_true(zcbor_list_start_decode(states), "Invalid array header");
+	zassert_equal(states->elem_count, count, "Invalid array length");
+
+	for (int i = 0; i < count; i++) {
+		zassert_true(zcbor_any_skip(states, NULL), "Invalid record %d", i);
+	}
+
+	zassert_true(zcbor_list_end_decode(states), "Invalid array end");
+	zassert_equal_ptr(states->payload, payload + len, "Data after the array");
+}
+
+ZTEST(net_content_senml_cbor, test_put_records)
+{
+	int ret;
+	int i, j;
+	uint8_t *payload;
+	sys_slist_t path_list;
+	int count[] = { 1, 3, TEST_RECORD_COUNT };
+	struct test_payload_buffer expected_header[] = {
+		{
+			.data = {
+				(0x04 << 5) | 1
+			},
+			.len = 1
+		},
+		{
+			.data = {
+				(0x04 << 5) | 3
+			},
+			.len = 1
+		},
+		{
+			.data = {
+				(0x04 << 5) | 24,
+				TEST_RECORD_COUNT
+			},
+			.len = 2
+		},
+	};
+	struct test_payload_buffer expected_record = {
+		.data = {
+			(0x05 << 5) | 3,
+			(0x01 << 5) | 1,
+			(0x03 << 5) | 9,
+			'/', '6', '5', '5', '3', '5', '/', '0', '/',
+			(0x00 << 5) | 0,
+			(0x03 << 5) | 1,
+			'0',
+			(0x00 << 5) | 2,
+			(0x00 << 5) | 0
+		},
+		.len = TEST_RECORD_LEN
+	};
+
+	test_s8 = 0;
+	test_s16 = 1;
+
+	for (i = 0; i < ARRAY_SIZE(count); i++) {
+		context_reset();
+		test_path_list_init(&path_list, count[i]);
+
+		ret = do_composite_read_op_for_parsed_path_senml_cbor(&test_msg, &path_list);
+		zassert_equal(ret, 0, "Error reported");
+
+		/* Records are encoded one by one, the array header is added
+		 * in front of them once all are written.
+		 */
+		payload = test_msg.msg_data + TEST_PAYLOAD_OFFSET;
+		zassert_mem_equal(payload, expected_header[i].data, expected_header[i].len,
+				  "Invalid array header");
+		payload += expected_header[i].len;
+
+		for (j = 0; j < count[i]; j++) {
+			/* Resource name and value */
+			expected_record.data[14] = '0' + j % 2;
+			expected_record.data[16] = j % 2;
+
+			zassert_mem_equal(payload, expected_record.data, expected_record.len,
+					  "Invalid record %d", j);
+			payload += expected_record.len;
+		}
+
+		zassert_equal(test_msg.cpkt.offset, payload - test_msg.msg_data,
+			      "Invalid packet offset");
+
+		test_senml_array_decode(test_msg.msg_data + TEST_PAYLOAD_OFFSET,
+					test_msg.cpkt.offset - TEST_PAYLOAD_OFFSET, count[i]);
+	}
+}
+
+ZTEST(net_content_senml_cbor_nomem, test_put_records_nomem)
+{
+	int ret;
+	sys_slist_t path_list;
+
+	/* Room for the option, payload marker and only a part of the records */
+	test_msg.cpkt.offset = sizeof(test_msg.msg_data) - TEST_PAYLOAD_OFFSET -
+			       TEST_RECORD_LEN * 2;
+	test_path_list_init(&path_list, TEST_RECORD_COUNT);
+
+	ret = do_composite_read_op_for_parsed_path_senml_cbor(&test_msg, &path_list);
+	zassert_equal(ret, -ENOMEM, "Invalid error code returned");
+}
+
 ZTEST(net_content_senml_cbor, test_get_s32)
 {
 	int ret;
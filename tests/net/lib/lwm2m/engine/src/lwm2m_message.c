@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "lwm2m_engine.h"
+#include "lwm2m_message_handling.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define TEST_MESSAGES CONFIG_LWM2M_ENGINE_MAX_PENDING
+
+static struct lwm2m_ctx ctx;
+static struct lwm2m_ctx other_ctx;
+static int replies_received;
+
+static int reply_cb(const struct coap_packet *response, struct coap_reply *reply,
+		    const struct sockaddr *from)
+{
+	replies_received++;
+	return 0;
+}
+
+static struct lwm2m_message *new_message(bool with_reply)
+{
+	struct lwm2m_message *msg;
+	int ret;
+
+	msg = lwm2m_get_message(&ctx);
+	zassert_not_null(msg, "No message available");
+
+	msg->type = COAP_TYPE_CON;
+	msg->code = COAP_METHOD_POST;
+	msg->mid = coap_next_id();
+	msg->tkl = LWM2M_MSG_TOKEN_GENERATE_NEW;
+	msg->reply_cb = with_reply ? reply_cb : NULL;
+
+	ret = lwm2m_init_message(msg);
+	zassert_equal(ret, 0, "Could not initialize message");
+	zassert_not_null(msg->pending, "No pending allocated");
+	zassert_equal(msg->reply != NULL, with_reply, "Wrong reply allocation");
+
+	return msg;
+}
+
+static void check_found(struct lwm2m_message *msg)
+{
+	zassert_equal_ptr(find_msg(msg->pending, NULL), msg,
+			  "Message not found by pending");
+
+	if (msg->reply) {
+		zassert_equal_ptr(find_msg(NULL, msg->reply), msg,
+				  "Message not found by reply");
+	}
+}
+
+static void before(void *data)
+{
+	ARG_UNUSED(data);
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.remote_addr.sa_family = AF_INET6;
+	replies_received = 0;
+}
+
+ZTEST(lwm2m_message, test_find_msg)
+{
+	struct lwm2m_message *msgs[TEST_MESSAGES];
+	struct coap_pending *pending;
+	struct coap_reply *reply;
+	int i;
+
+	zassert_is_null(find_msg(NULL, NULL), "Found message without key");
+	zassert_is_null(find_msg(&ctx.pendings[0], NULL),
+			"Found message for unused pending");
+
+	for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+		msgs[i] = new_message(i % 2 == 0);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+		check_found(msgs[i]);
+	}
+
+	/* Released messages are not found anymore, and their pendings
+	 * and replies are found again once reused by other messages.
+	 */
+	pending = msgs[0]->pending;
+	reply = msgs[0]->reply;
+	lwm2m_reset_message(msgs[0], true);
+
+	zassert_is_null(find_msg(pending, NULL), "Released message found");
+	zassert_is_null(find_msg(NULL, reply), "Released message found");
+
+	msgs[0] = new_message(true);
+	check_found(msgs[0]);
+
+	/* Other messages are still found after a release */
+	lwm2m_reset_message(msgs[2], true);
+	msgs[2] = NULL;
+
+	for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+		if (msgs[i]) {
+			check_found(msgs[i]);
+		}
+	}
+
+	for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+		if (msgs[i]) {
+			lwm2m_reset_message(msgs[i], true);
+		}
+	}
+
+	for (i = 0; i < ARRAY_SIZE(ctx.pendings); i++) {
+		zassert_is_null(find_msg(&ctx.pendings[i], NULL),
+				"Found message for unused pending");
+	}
+
+	for (i = 0; i < ARRAY_SIZE(ctx.replies); i++) {
+		zassert_is_null(find_msg(NULL, &ctx.replies[i]),
+				"Found message for unused reply");
+	}
+}
+
+ZTEST(lwm2m_message, test_find_msg_by_mid_and_token)
+{
+	struct lwm2m_message *msgs[TEST_MESSAGES];
+	struct coap_reply *reply;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+		msgs[i] = new_message(i % 2 == 0);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_equal_ptr(find_msg_by_mid(&ctx, msgs[i]->pending->id), msgs[i],
+				  "Message not found by message ID");
+		zassert_is_null(find_msg_by_mid(&other_ctx, msgs[i]->pending->id),
+				"Message found for another context");
+
+		reply = msgs[i]->reply;
+		if (!reply) {
+			continue;
+		}
+
+		zassert_equal_ptr(find_msg_by_token(&ctx, reply->token, reply->tkl, 0), msgs[i],
+				  "Message not found by token");
+		zassert_is_null(find_msg_by_token(&other_ctx, reply->token, reply->tkl, 0),
+				"Message found for another context");
+		zassert_is_null(find_msg_by_token(&ctx, reply->token, reply->tkl - 1, 0),
+				"Message found for a shorter token");
+
+		memcpy(token, reply->token, reply->tkl);
+		token[0] ^= 0xff;
+		zassert_is_null(find_msg_by_token(&ctx, token, reply->tkl, 0),
+				"Message found for another token");
+	}
+
+	lwm2m_reset_message(msgs[0], true);
+	zassert_is_null(find_msg_by_mid(&ctx, msgs[0]->mid), "Released message found");
+
+	for (i = 1; i < ARRAY_SIZE(msgs); i++) {
+		lwm2m_reset_message(msgs[i], true);
+	}
+}
+
+ZTEST(lwm2m_message, test_receive_response)
+{
+	struct lwm2m_message *msgs[TEST_MESSAGES];
+	struct lwm2m_message *msg;
+	struct coap_packet response;
+	uint8_t buf[32];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+		msgs[i] = new_message(true);
+	}
+
+	/* A piggybacked response is matched to its message by ID and token,
+	 * and releases the message.
+	 */
+	msg = msgs[ARRAY_SIZE(msgs) / 2];
+	zassert_ok(coap_packet_init(&response, buf, sizeof(buf), COAP_VERSION_1,
+				    COAP_TYPE_ACK, msg->reply->tkl, msg->reply->token,
+				    COAP_RESPONSE_CODE_CHANGED, msg->pending->id));
+
+	lwm2m_udp_receive(&ctx, buf, response.offset, &ctx.remote_addr, NULL);
+
+	zassert_equal(replies_received, 1, "Reply callback not called");
+	zassert_is_null(msg->ctx, "Message not released");
+
+	for (i = 0; i < ARRAY_SIZE(msgs); i++) {
+		if (msgs[i] != msg) {
+			zassert_equal_ptr(msgs[i]->ctx, &ctx, "Wrong message released");
+			lwm2m_reset_message(msgs[i], true);
+		}
+	}
+}
+
+ZTEST_SUITE(lwm2m_message, NULL, NULL, before, NULL, NULL);
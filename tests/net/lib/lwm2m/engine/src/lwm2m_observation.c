@@ -5,6 +5,8 @@
  */
 
 #include "lwm2m_engine.h"
+#include "lwm2m_message_handling.h"
+#include "lwm2m_observation.h"
 #include "lwm2m_util.h"
 
 #include <zephyr/kernel.h>
@@ -503,4 +505,71 @@ ZTEST(lwm2m_observation, test_add_path_to_list_duplicate)
 	run_insertion_test(insert_path_str, ARRAY_SIZE(insert_path_str), expected_path_str);
 }
 
+ZTEST(lwm2m_observation, test_notify_observer_path)
+{
+	static struct lwm2m_ctx ctx;
+	static uint8_t token[] = { 0x01, 0x02, 0x03, 0x04 };
+	struct lwm2m_obj_path path = LWM2M_OBJ(3, 0, 13);
+	struct lwm2m_message *msg;
+	struct observe_node *obs;
+	int64_t event_timestamp;
+	int ret;
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.sock_fd = -1;
+	ctx.remote_addr.sa_family = AF_INET6;
+	lwm2m_engine_context_init(&ctx);
+	zassert_equal(lwm2m_socket_add(&ctx), 0);
+
+	zassert_false(lwm2m_path_is_observed(&path));
+	zassert_equal(lwm2m_notify_observer_path(&path), 0);
+
+	msg = lwm2m_get_message(&ctx);
+	zassert_not_null(msg);
+	msg->type = COAP_TYPE_ACK;
+	msg->code = COAP_RESPONSE_CODE_CONTENT;
+	msg->mid = coap_next_id();
+	msg->token = token;
+	msg->tkl = sizeof(token);
+	zassert_equal(lwm2m_init_message(msg), 0);
+	msg->out.out_cpkt = &msg->cpkt;
+	msg->path = path;
+
+	ret = lwm2m_engine_observation_handler(msg, 0, LWM2M_FORMAT_PLAIN_TEXT, false);
+	zassert_equal(ret, 0);
+	zassert_true(lwm2m_path_is_observed(&path));
+
+	obs = SYS_SLIST_PEEK_HEAD_CONTAINER(&ctx.observer, obs, node);
+	zassert_not_null(obs);
+	zassert_false(obs->resource_update);
+
+	zassert_equal_ptr(engine_observe_node_find_by_token(&ctx, token, sizeof(token)), obs);
+	zassert_is_null(engine_observe_node_find_by_token(&ctx, token, sizeof(token) - 1));
+	zassert_is_null(engine_observe_node_find_by_token(NULL, token, sizeof(token)));
+
+	/* A change schedules a notification, further changes before it is sent
+	 * are reported by the same notification.
+	 */
+	zassert_equal(lwm2m_notify_observer_path(&path), 1);
+	zassert_true(obs->resource_update);
+	event_timestamp = obs->event_timestamp;
+	zassert_true(ctx.next_notify_timestamp <= event_timestamp);
+
+	zassert_equal(lwm2m_notify_observer_path(&path), 1);
+	zassert_equal(obs->event_timestamp, event_timestamp);
+
+	zassert_equal(lwm2m_notify_observer_path(&LWM2M_OBJ(3, 0, 14)), 0);
+	zassert_equal(lwm2m_notify_observer_path(&LWM2M_OBJ(4, 0, 0)), 0);
+	zassert_false(lwm2m_path_is_observed(&LWM2M_OBJ(4, 0, 0)));
+
+	ret = engine_remove_observer_by_token(&ctx, token, sizeof(token));
+	zassert_equal(ret, 0);
+	zassert_false(lwm2m_path_is_observed(&path));
+	zassert_is_null(engine_observe_node_find_by_token(&ctx, token, sizeof(token)));
+	zassert_equal(lwm2m_notify_observer_path(&path), 0);
+
+	lwm2m_reset_message(msg, true);
+	lwm2m_socket_del(&ctx);
+}
+
 ZTEST_SUITE(lwm2m_observation, NULL, NULL, NULL, NULL, NULL);
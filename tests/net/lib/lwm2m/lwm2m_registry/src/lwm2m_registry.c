@@ -385,3 +385,124 @@ ZTEST(lwm2m_registry, test_null_strings)
 	zassert_equal(ret, 0);
 	zassert_equal(strlen(buf), 0);
 }
+
+#define TEST_OBJ_ID 32769
+#define TEST_OBJ_INST_COUNT 64
+
+/* Resource IDs deliberately out of order and with gaps */
+static struct lwm2m_engine_obj_field test_obj_fields[] = {
+	OBJ_FIELD_DATA(5, RW, U32),
+	OBJ_FIELD_DATA(0, RW, U32),
+	OBJ_FIELD_DATA(2, RW, U32),
+};
+
+static struct lwm2m_engine_obj test_obj;
+static struct lwm2m_engine_obj_inst test_inst[TEST_OBJ_INST_COUNT];
+static struct lwm2m_engine_res test_res[TEST_OBJ_INST_COUNT][ARRAY_SIZE(test_obj_fields)];
+static struct lwm2m_engine_res_inst test_res_inst[TEST_OBJ_INST_COUNT]
+						 [ARRAY_SIZE(test_obj_fields)];
+static uint32_t test_data[TEST_OBJ_INST_COUNT][ARRAY_SIZE(test_obj_fields)];
+
+static struct lwm2m_engine_obj_inst *test_obj_create(uint16_t obj_inst_id)
+{
+	int index, i = 0, j = 0;
+
+	for (index = 0; index < TEST_OBJ_INST_COUNT; index++) {
+		if (!test_inst[index].obj) {
+			break;
+		}
+	}
+
+	if (index == TEST_OBJ_INST_COUNT) {
+		return NULL;
+	}
+
+	init_res_instance(test_res_inst[index], ARRAY_SIZE(test_res_inst[index]));
+	INIT_OBJ_RES_DATA(5, test_res[index], i, test_res_inst[index], j,
+			  &test_data[index][0], sizeof(uint32_t));
+	INIT_OBJ_RES_DATA(0, test_res[index], i, test_res_inst[index], j,
+			  &test_data[index][1], sizeof(uint32_t));
+	INIT_OBJ_RES_DATA(2, test_res[index], i, test_res_inst[index], j,
+			  &test_data[index][2], sizeof(uint32_t));
+
+	test_inst[index].resources = test_res[index];
+	test_inst[index].resource_count = i;
+
+	return &test_inst[index];
+}
+
+static uint16_t test_inst_id(int index)
+{
+	return 100 + index * 7;
+}
+
+ZTEST(lwm2m_registry, test_indexed_lookup)
+{
+	struct lwm2m_engine_obj_inst *obj_inst;
+	uint32_t value;
+	int ret, i;
+
+	test_obj.obj_id = TEST_OBJ_ID;
+	test_obj.fields = test_obj_fields;
+	test_obj.field_count = ARRAY_SIZE(test_obj_fields);
+	test_obj.max_instance_count = TEST_OBJ_INST_COUNT;
+	test_obj.create_cb = test_obj_create;
+	lwm2m_register_obj(&test_obj);
+
+	zassert_equal_ptr(get_engine_obj(TEST_OBJ_ID), &test_obj);
+	zassert_is_null(get_engine_obj(TEST_OBJ_ID + 1));
+
+	for (i = 0; i < TEST_OBJ_INST_COUNT; i++) {
+		ret = lwm2m_create_object_inst(&LWM2M_OBJ(TEST_OBJ_ID, test_inst_id(i)));
+		zassert_equal(ret, 0);
+	}
+
+	for (i = 0; i < TEST_OBJ_INST_COUNT; i++) {
+		obj_inst = get_engine_obj_inst(TEST_OBJ_ID, test_inst_id(i));
+		zassert_not_null(obj_inst);
+		zassert_equal(obj_inst->obj_inst_id, test_inst_id(i));
+
+		ret = lwm2m_set_u32(&LWM2M_OBJ(TEST_OBJ_ID, test_inst_id(i), 2), i);
+		zassert_equal(ret, 0);
+		ret = lwm2m_set_u32(&LWM2M_OBJ(TEST_OBJ_ID, test_inst_id(i), 5), i * 2);
+		zassert_equal(ret, 0);
+	}
+
+	zassert_is_null(get_engine_obj_inst(TEST_OBJ_ID, test_inst_id(0) + 1));
+	zassert_is_null(get_engine_obj_inst(TEST_OBJ_ID + 1, test_inst_id(0)));
+	zassert_is_null(lwm2m_get_engine_obj_field(&test_obj, 1));
+	zassert_equal(lwm2m_get_engine_obj_field(&test_obj, 2)->res_id, 2);
+	zassert_is_null(lwm2m_engine_get_res(&LWM2M_OBJ(TEST_OBJ_ID, test_inst_id(0), 1)));
+
+	/* Deleted instances must disappear from the index */
+	for (i = 0; i < TEST_OBJ_INST_COUNT; i += 2) {
+		ret = lwm2m_delete_object_inst(&LWM2M_OBJ(TEST_OBJ_ID, test_inst_id(i)));
+		zassert_equal(ret, 0);
+	}
+
+	for (i = 0; i < TEST_OBJ_INST_COUNT; i++) {
+		obj_inst = get_engine_obj_inst(TEST_OBJ_ID, test_inst_id(i));
+		ret = lwm2m_get_u32(&LWM2M_OBJ(TEST_OBJ_ID, test_inst_id(i), 2), &value);
+
+		if (i % 2 == 0) {
+			zassert_is_null(obj_inst);
+			zassert_equal(ret, -ENOENT);
+			continue;
+		}
+
+		zassert_not_null(obj_inst);
+		zassert_equal(ret, 0);
+		zassert_equal(value, i);
+		ret = lwm2m_get_u32(&LWM2M_OBJ(TEST_OBJ_ID, test_inst_id(i), 5), &value);
+		zassert_equal(ret, 0);
+		zassert_equal(value, i * 2);
+	}
+
+	for (i = 1; i < TEST_OBJ_INST_COUNT; i += 2) {
+		ret = lwm2m_delete_object_inst(&LWM2M_OBJ(TEST_OBJ_ID, test_inst_id(i)));
+		zassert_equal(ret, 0);
+	}
+
+	lwm2m_unregister_obj(&test_obj);
+	zassert_is_null(get_engine_obj(TEST_OBJ_ID));
+}
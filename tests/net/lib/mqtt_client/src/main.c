@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/net/mqtt.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include "mqtt_transport.h"
+
+#define BUFFER_SIZE 128
+#define STREAM_SIZE 1024
+
+#define TOPIC MQTT_UTF8_LITERAL("sensors")
+
+static uint8_t rx_buffer[BUFFER_SIZE];
+static uint8_t tx_buffer[BUFFER_SIZE];
+static struct mqtt_client client;
+
+/* Bytes written by the client, and number of transport writes. */
+static uint8_t tx_stream[STREAM_SIZE];
+static size_t tx_stream_len;
+static int tx_writes;
+static bool tx_fail;
+
+/* Buffers referenced by the I/O vectors of the last write. */
+static const void *tx_iov_base[4];
+static size_t tx_iov_count;
+
+/* Bytes the fake broker has queued for the client. */
+static uint8_t rx_stream[STREAM_SIZE];
+static size_t rx_stream_len;
+static size_t rx_stream_pos;
+
+static uint8_t payload[] = "21.5";
+
+int mqtt_client_custom_transport_connect(struct mqtt_client *client)
+{
+	return 0;
+}
+
+int mqtt_client_custom_transport_write(struct mqtt_client *client,
+				       const uint8_t *data, uint32_t datalen)
+{
+	zassert_true(tx_stream_len + datalen <= sizeof(tx_stream),
+		     "TX stream overflow");
+
+	memcpy(&tx_stream[tx_stream_len], data, datalen);
+	tx_stream_len += datalen;
+	tx_writes++;
+
+	return 0;
+}
+
+int mqtt_client_custom_transport_write_msg(struct mqtt_client *client,
+					   const struct msghdr *message)
+{
+	if (tx_fail) {
+		return -EIO;
+	}
+
+	tx_iov_count = MIN(message->msg_iovlen, ARRAY_SIZE(tx_iov_base));
+
+	for (int i = 0; i < message->msg_iovlen; i++) {
+		size_t len = message->msg_iov[i].iov_len;
+
+		if (i < ARRAY_SIZE(tx_iov_base)) {
+			tx_iov_base[i] = message->msg_iov[i].iov_base;
+		}
+
+		zassert_true(tx_stream_len + len <= sizeof(tx_stream),
+			     "TX stream overflow");
+
+		memcpy(&tx_stream[tx_stream_len], message->msg_iov[i].iov_base,
+		       len);
+		tx_stream_len += len;
+	}
+
+	tx_writes++;
+
+	return 0;
+}
+
+int mqtt_client_custom_transport_read(struct mqtt_client *client,
+				      uint8_t *data, uint32_t buflen,
+				      bool shall_block)
+{
+	size_t len = MIN(buflen, rx_stream_len - rx_stream_pos);
+
+	if (len == 0) {
+		return -EAGAIN;
+	}
+
+	memcpy(data, &rx_stream[rx_stream_pos], len);
+	rx_stream_pos += len;
+
+	return len;
+}
+
+int mqtt_client_custom_transport_disconnect(struct mqtt_client *client)
+{
+	return 0;
+}
+
+static void mqtt_evt_handler(struct mqtt_client *const client,
+			     const struct mqtt_evt *evt)
+{
+}
+
+static void broker_send(const uint8_t *data, size_t len)
+{
+	memcpy(&rx_stream[rx_stream_len], data, len);
+	rx_stream_len += len;
+
+	while (rx_stream_pos < rx_stream_len) {
+		zassert_equal(mqtt_input(&client), 0, "Input failed");
+	}
+}
+
+static void broker_ack(uint8_t type, uint16_t message_id)
+{
+	uint8_t ack[] = { type, 0x02, message_id >> 8, message_id & 0xff };
+
+	broker_send(ack, sizeof(ack));
+}
+
+static void tx_stream_reset(void)
+{
+	tx_stream_len = 0;
+	tx_writes = 0;
+}
+
+/* Collect the first byte of each packet the client sent, and return the
+ * offset of the variable header of the last one.
+ */
+static int tx_packets(uint8_t *types, int max, int *count)
+{
+	size_t offset = 0;
+	size_t var_offset = 0;
+
+	*count = 0;
+
+	while (offset < tx_stream_len) {
+		uint32_t length = 0;
+		int shift = 0;
+		uint8_t byte;
+
+		zassert_true(*count < max, "Too many packets");
+		types[(*count)++] = tx_stream[offset++];
+
+		do {
+			byte = tx_stream[offset++];
+			length |= (byte & 0x7f) << shift;
+			shift += 7;
+		} while (byte & 0x80);
+
+		var_offset = offset;
+		offset += length;
+	}
+
+	zassert_equal(offset, tx_stream_len, "Truncated packet");
+
+	return var_offset;
+}
+
+static void client_connect(bool session_present)
+{
+	const uint8_t connack[] = { 0x20, 0x02, session_present, 0x00 };
+
+	zassert_equal(mqtt_connect(&client), 0, "Connect failed");
+
+	tx_stream_reset();
+	broker_send(connack, sizeof(connack));
+}
+
+static void publish_param_init(struct mqtt_publish_param *param, uint8_t qos,
+			       uint16_t message_id)
+{
+	memset(param, 0, sizeof(*param));
+
+	param->message.topic.topic = (struct mqtt_utf8)TOPIC;
+	param->message.topic.qos = qos;
+	param->message.payload.data = payload;
+	param->message.payload.len = sizeof(payload) - 1;
+	param->message_id = message_id;
+}
+
+static void client_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	mqtt_client_init(&client);
+
+	client.client_id.utf8 = (uint8_t *)"zephyr";
+	client.client_id.size = strlen("zephyr");
+	client.evt_cb = mqtt_evt_handler;
+	client.rx_buf = rx_buffer;
+	client.rx_buf_size = sizeof(rx_buffer);
+	client.tx_buf = tx_buffer;
+	client.tx_buf_size = sizeof(tx_buffer);
+	client.transport.type = MQTT_TRANSPORT_CUSTOM;
+	client.clean_session = 0;
+
+	rx_stream_len = 0;
+	rx_stream_pos = 0;
+	tx_stream_reset();
+	tx_fail = false;
+}
+
+static void client_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	mqtt_abort(&client);
+}
+
+ZTEST(mqtt_client, test_publish_batch)
+{
+	struct mqtt_publish_param params[12];
+	uint8_t types[ARRAY_SIZE(params)];
+	int count;
+
+	client_connect(false);
+
+	for (int i = 0; i < ARRAY_SIZE(params); i++) {
+		publish_param_init(&params[i], MQTT_QOS_0_AT_MOST_ONCE, 0);
+	}
+
+	zassert_equal(mqtt_publish_batch(&client, params, 5), 5,
+		      "Batch not sent");
+	zassert_equal(tx_writes, 1, "Batch not sent in a single write");
+
+	tx_packets(types, ARRAY_SIZE(types), &count);
+	zassert_equal(count, 5, "Wrong number of packets");
+
+	for (int i = 0; i < count; i++) {
+		zassert_equal(types[i], 0x30, "Not a QoS 0 PUBLISH");
+	}
+
+	/* More headers than the TX buffer holds are split in several writes */
+	tx_stream_reset();
+
+	zassert_equal(mqtt_publish_batch(&client, params, ARRAY_SIZE(params)),
+		      ARRAY_SIZE(params), "Batch not sent");
+	zassert_true(tx_writes > 1, "TX buffer overflow not handled");
+
+	tx_packets(types, ARRAY_SIZE(types), &count);
+	zassert_equal(count, ARRAY_SIZE(params), "Wrong number of packets");
+}
+
+ZTEST(mqtt_client, test_inflight_window)
+{
+	struct mqtt_publish_param params[CONFIG_MQTT_INFLIGHT_WINDOW_SIZE + 1];
+	struct mqtt_publish_param param;
+
+	client_connect(false);
+
+	for (int i = 0; i < ARRAY_SIZE(params); i++) {
+		publish_param_init(&params[i], MQTT_QOS_1_AT_LEAST_ONCE, i + 1);
+	}
+
+	/* The batch stops when the window is full */
+	zassert_equal(mqtt_publish_batch(&client, params, ARRAY_SIZE(params)),
+		      CONFIG_MQTT_INFLIGHT_WINDOW_SIZE, "Window not enforced");
+
+	zassert_equal(mqtt_publish(&client, &params[ARRAY_SIZE(params) - 1]),
+		      -EAGAIN, "Window not enforced");
+
+	/* A message id may only be reused for a retransmission */
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, 1);
+	zassert_equal(mqtt_publish(&client, &param), -EEXIST,
+		      "Duplicate message id accepted");
+
+	param.dup_flag = 1U;
+	zassert_equal(mqtt_publish(&client, &param), 0,
+		      "Retransmission rejected");
+
+	broker_ack(0x40, 1);
+
+	zassert_equal(mqtt_publish(&client, &params[ARRAY_SIZE(params) - 1]),
+		      0, "Acknowledged message not removed from window");
+}
+
+ZTEST(mqtt_client, test_inflight_resend)
+{
+	struct mqtt_publish_param qos1, qos2, qos2_released;
+	uint8_t types[4];
+	int offset;
+	int count;
+
+	client_connect(false);
+
+	publish_param_init(&qos1, MQTT_QOS_1_AT_LEAST_ONCE, 10);
+	publish_param_init(&qos2, MQTT_QOS_2_EXACTLY_ONCE, 11);
+	publish_param_init(&qos2_released, MQTT_QOS_2_EXACTLY_ONCE, 12);
+
+	zassert_equal(mqtt_publish(&client, &qos1), 0, "Publish failed");
+	zassert_equal(mqtt_publish(&client, &qos2), 0, "Publish failed");
+	zassert_equal(mqtt_publish(&client, &qos2_released), 0,
+		      "Publish failed");
+
+	broker_ack(0x50, 12);
+
+	mqtt_abort(&client);
+	client_connect(true);
+
+	tx_packets(types, ARRAY_SIZE(types), &count);
+	zassert_equal(count, 3, "In-flight messages not resent");
+	zassert_equal(types[0], 0x3a, "QoS 1 PUBLISH not resent as DUP");
+	zassert_equal(types[1], 0x3c, "QoS 2 PUBLISH not resent as DUP");
+	zassert_equal(types[2], 0x62, "PUBREL not resent");
+
+	offset = tx_packets(types, ARRAY_SIZE(types), &count);
+	zassert_equal(sys_get_be16(&tx_stream[offset]), 12, "Wrong PUBREL id");
+
+	broker_ack(0x40, 10);
+	broker_ack(0x50, 11);
+	broker_ack(0x70, 11);
+	broker_ack(0x70, 12);
+
+	mqtt_abort(&client);
+	client_connect(true);
+
+	zassert_equal(tx_stream_len, 0, "Acknowledged messages resent");
+}
+
+ZTEST(mqtt_client, test_clean_session)
+{
+	struct mqtt_publish_param param;
+
+	client_connect(false);
+
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, 10);
+	zassert_equal(mqtt_publish(&client, &param), 0, "Publish failed");
+
+	mqtt_abort(&client);
+	client.clean_session = 1;
+	client_connect(false);
+
+	zassert_equal(tx_stream_len, 0, "Clean session resent messages");
+}
+
+ZTEST(mqtt_client, test_publish_zero_copy)
+{
+	struct mqtt_publish_param param;
+	const uint8_t *header;
+	size_t header_len;
+
+	client_connect(false);
+
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, 10);
+	memset(tx_buffer, 0xaa, sizeof(tx_buffer));
+
+	zassert_equal(mqtt_publish(&client, &param), 0, "Publish failed");
+
+	/* The payload is sent from the caller's buffer, not from tx_buf */
+	zassert_equal(tx_iov_count, 2, "Payload not in its own I/O vector");
+	zassert_equal_ptr(tx_iov_base[1], payload, "Payload copied");
+
+	header = tx_iov_base[0];
+	header_len = tx_stream_len - param.message.payload.len;
+	zassert_true(header >= tx_buffer &&
+		     header + header_len <= tx_buffer + sizeof(tx_buffer),
+		     "Header not in tx_buf");
+	zassert_mem_equal(&tx_stream[header_len], payload,
+			  param.message.payload.len, "Wrong payload");
+
+	/* Only the bytes of the header are written to tx_buf */
+	for (size_t i = header + header_len - tx_buffer;
+	     i < sizeof(tx_buffer); i++) {
+		zassert_equal(tx_buffer[i], 0xaa, "tx_buf written past header");
+	}
+}
+
+ZTEST(mqtt_client, test_session_not_present)
+{
+	struct mqtt_publish_param param;
+
+	client_connect(false);
+
+	publish_param_init(&param, MQTT_QOS_1_AT_LEAST_ONCE, 10);
+	zassert_equal(mqtt_publish(&client, &param), 0, "Publish failed");
+
+	/* The broker lost the session, the message is no longer in flight */
+	mqtt_abort(&client);
+	client_connect(false);
+
+	zassert_equal(tx_stream_len, 0, "Messages resent to a new session");
+	zassert_equal(mqtt_publish(&client, &param), 0,
+		      "Message id still in flight");
+}
+
+ZTEST(mqtt_client, test_publish_write_failure)
+{
+	struct mqtt_publish_param params[2];
+
+	client_connect(false);
+
+	publish_param_init(&params[0], MQTT_QOS_1_AT_LEAST_ONCE, 10);
+	publish_param_init(&params[1], MQTT_QOS_2_EXACTLY_ONCE, 11);
+
+	tx_fail = true;
+	zassert_equal(mqtt_publish(&client, &params[0]), -EIO,
+		      "Write failure not reported");
+
+	client_connect(false);
+	zassert_equal(mqtt_publish_batch(&client, params, ARRAY_SIZE(params)),
+		      -EIO, "Write failure not reported");
+	tx_fail = false;
+
+	/* Messages which were not sent are neither resent nor in flight */
+	client_connect(true);
+	zassert_equal(tx_stream_len, 0, "Unsent messages resent");
+
+	zassert_equal(mqtt_publish_batch(&client, params, ARRAY_SIZE(params)),
+		      ARRAY_SIZE(params), "Message ids still in flight");
+}
+
+ZTEST(mqtt_client, test_publish_batch_empty_payloads)
+{
+	/* Messages without a payload take a single I/O vector each, so more
+	 * of them fit in a write than messages with a payload.
+	 */
+	struct mqtt_publish_param params[11];
+	uint8_t types[ARRAY_SIZE(params)];
+	int count;
+
+	client_connect(false);
+
+	for (int i = 0; i < ARRAY_SIZE(params); i++) {
+		if (i < 8) {
+			publish_param_init(&params[i], MQTT_QOS_0_AT_MOST_ONCE, 0);
+		} else {
+			publish_param_init(&params[i], MQTT_QOS_1_AT_LEAST_ONCE,
+					   i + 10);
+		}
+
+		params[i].message.topic.topic = (struct mqtt_utf8)MQTT_UTF8_LITERAL("t");
+		params[i].message.payload.data = NULL;
+		params[i].message.payload.len = 0;
+	}
+
+	tx_fail = true;
+	zassert_equal(mqtt_publish_batch(&client, params, ARRAY_SIZE(params)),
+		      -EIO, "Write failure not reported");
+	tx_fail = false;
+
+	/* None of the messages of the failed write is in flight */
+	client_connect(true);
+	zassert_equal(tx_stream_len, 0, "Unsent messages resent");
+
+	zassert_equal(mqtt_publish_batch(&client, params, ARRAY_SIZE(params)),
+		      ARRAY_SIZE(params), "Message ids still in flight");
+	zassert_equal(tx_writes, 1, "Batch not sent in a single write");
+
+	tx_packets(types, ARRAY_SIZE(types), &count);
+	zassert_equal(count, ARRAY_SIZE(params), "Wrong number of packets");
+}
+
+ZTEST_SUITE(mqtt_client, NULL, NULL, client_before, client_after, NULL);
@@ -544,6 +544,123 @@ static void test_route_preference(void)
 	net_route_del(entry);
 }
 
+static struct net_route_entry *add_prefix_route(struct in6_addr *prefix,
+						uint8_t prefix_len,
+						struct in6_addr *nexthop)
+{
+	struct net_route_entry *route;
+
+	route = net_route_add(my_iface, prefix, prefix_len, nexthop,
+			      NET_IPV6_ND_INFINITE_LIFETIME,
+			      NET_ROUTE_PREFERENCE_MEDIUM);
+	zassert_not_null(route, "Route add %s/%d failed",
+			 net_sprint_ipv6_addr(prefix), prefix_len);
+
+	return route;
+}
+
+static void check_lookup(struct in6_addr *dst, struct net_route_entry *route)
+{
+	zassert_equal_ptr(net_route_lookup(my_iface, dst), route,
+			  "Wrong route for %s", net_sprint_ipv6_addr(dst));
+	zassert_equal_ptr(net_route_lookup(NULL, dst), route,
+			  "Wrong route for %s on any interface",
+			  net_sprint_ipv6_addr(dst));
+}
+
+static void test_route_longest_prefix(void)
+{
+	struct net_route_entry *host, *net_0, *net_1, *site;
+	struct in6_addr prefix, dst_0, dst_1, dst_site, dst_none;
+
+	net_ipv6_addr_create(&dst_0, 0x2001, 0xdb8, 0, 0, 0, 0, 0, 0x1234);
+	net_ipv6_addr_create(&dst_1, 0x2001, 0xdb8, 0, 1, 0, 0, 0, 0x5);
+	net_ipv6_addr_create(&dst_site, 0x2001, 0xdb8, 0, 5, 0, 0, 0, 0x1);
+	net_ipv6_addr_create(&dst_none, 0x2001, 0xdb9, 0, 0, 0, 0, 0, 0x1);
+
+	/* Adding a route replaces an existing route covering the new
+	 * prefix, so add the more specific routes first.
+	 */
+	host = add_prefix_route(&dest_addr, 128, &peer_addr);
+
+	net_ipv6_addr_create(&prefix, 0x2001, 0xdb8, 0, 0, 0, 0, 0, 0);
+	net_0 = add_prefix_route(&prefix, 64, &peer_addr_alt);
+
+	net_ipv6_addr_create(&prefix, 0x2001, 0xdb8, 0, 1, 0, 0, 0, 0);
+	net_1 = add_prefix_route(&prefix, 64, &peer_addr);
+
+	/* Host bits after the prefix length are ignored */
+	net_ipv6_addr_create(&prefix, 0x2001, 0xdb8, 0, 2, 0, 0, 0, 0);
+	site = add_prefix_route(&prefix, 48, &peer_addr_alt);
+
+	check_lookup(&dest_addr, host);
+	check_lookup(&dst_0, net_0);
+	check_lookup(&dst_1, net_1);
+	check_lookup(&dst_site, site);
+	check_lookup(&dst_none, NULL);
+	zassert_is_null(net_route_lookup(peer_iface, &dest_addr),
+			"Route found on wrong interface");
+
+	zassert_equal(net_route_del(net_0), 0, "Route del failed");
+	check_lookup(&dst_0, site);
+	check_lookup(&dest_addr, host);
+
+	zassert_equal(net_route_del(host), 0, "Route del failed");
+	check_lookup(&dest_addr, site);
+	check_lookup(&dst_1, net_1);
+
+	zassert_equal(net_route_del(net_1), 0, "Route del failed");
+	check_lookup(&dst_1, site);
+
+	zassert_equal(net_route_del(site), 0, "Route del failed");
+	check_lookup(&dest_addr, NULL);
+	check_lookup(&dst_0, NULL);
+	check_lookup(&dst_1, NULL);
+	check_lookup(&dst_site, NULL);
+}
+
+static void test_route_same_prefix(void)
+{
+	struct net_route_entry *first, *second, *third;
+	struct net_nbr *nbr;
+	struct in6_addr prefix, dst;
+
+	nbr = net_ipv6_nbr_add(peer_iface, &peer_addr_alt,
+			       &net_route_data_peer.ll_addr, false,
+			       NET_IPV6_NBR_STATE_REACHABLE);
+	zassert_not_null(nbr, "Cannot add peer to neighbor cache");
+
+	net_ipv6_addr_create(&prefix, 0x2001, 0xdb8, 0, 7, 0, 0, 0, 0);
+	net_ipv6_addr_create(&dst, 0x2001, 0xdb8, 0, 7, 0, 0, 0, 0x1);
+
+	first = add_prefix_route(&prefix, 64, &peer_addr);
+	second = net_route_add(peer_iface, &prefix, 64, &peer_addr_alt,
+			       NET_IPV6_ND_INFINITE_LIFETIME,
+			       NET_ROUTE_PREFERENCE_MEDIUM);
+	zassert_not_null(second, "Route add failed");
+
+	/* Without an interface, the route in the highest slot is used */
+	zassert_true(second > first, "Routes not allocated in order");
+	zassert_equal_ptr(net_route_lookup(NULL, &dst), second,
+			  "Route in the highest slot not preferred");
+	zassert_equal_ptr(net_route_lookup(my_iface, &dst), first,
+			  "Wrong route on my interface");
+
+	/* A route reusing a lower slot doesn't win, even if added last */
+	zassert_equal(net_route_del(first), 0, "Route del failed");
+	third = add_prefix_route(&prefix, 64, &peer_addr);
+	zassert_true(third < second, "Freed slot not reused");
+	zassert_equal_ptr(net_route_lookup(NULL, &dst), second,
+			  "Route in a lower slot preferred");
+
+	zassert_equal(net_route_del(second), 0, "Route del failed");
+	zassert_equal_ptr(net_route_lookup(NULL, &dst), third,
+			  "Remaining route not found");
+
+	zassert_equal(net_route_del(third), 0, "Route del failed");
+	zassert_true(net_ipv6_nbr_rm(peer_iface, &peer_addr_alt),
+		     "Cannot remove neighbor");
+}
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +683,8 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix();
+	test_route_same_prefix();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_epoll.h>
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define TEST_STR_SMALL "test"
+
+#define MY_IPV6_ADDR "::1"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+/* On QEMU, waits take +10ms from the requested time. */
+#define FUZZ 10
+
+#define TCP_TEARDOWN_TIMEOUT K_SECONDS(3)
+
+struct send_work_data {
+	struct k_work_delayable work;
+	int sock;
+};
+
+static void send_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct send_work_data *data =
+		CONTAINER_OF(dwork, struct send_work_data, work);
+
+	(void)send(data->sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+}
+
+static void epoll_add(int epfd, int sock, uint32_t events)
+{
+	struct zsock_epoll_event ev = {
+		.events = events,
+		.data.fd = sock,
+	};
+
+	zassert_equal(zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, sock, &ev), 0,
+		      "epoll_ctl ADD failed (%d)", errno);
+}
+
+ZTEST(net_socket_epoll, test_epoll_udp)
+{
+	struct zsock_epoll_event events[2];
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct send_work_data send_data;
+	uint32_t tstamp;
+	char buf[10];
+	int c_sock;
+	int s_sock;
+	int epfd;
+	int res;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	epfd = zsock_epoll_create();
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	epoll_add(epfd, s_sock, POLLIN);
+
+	/* Adding twice is not allowed */
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, s_sock, &events[0]);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EEXIST, "");
+
+	/* Nothing ready yet */
+	tstamp = k_uptime_get_32();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_true(k_uptime_get_32() - tstamp <= FUZZ, "");
+	zassert_equal(res, 0, "");
+
+	tstamp = k_uptime_get_32();
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 30);
+	tstamp = k_uptime_get_32() - tstamp;
+	zassert_true(tstamp >= 30U && tstamp <= 30 + FUZZ * 2, "tstamp %d",
+		     tstamp);
+	zassert_equal(res, 0, "");
+
+	/* Data arriving while waiting wakes the waiter up */
+	send_data.sock = c_sock;
+	k_work_init_delayable(&send_data.work, send_work_handler);
+	k_work_reschedule(&send_data.work, K_MSEC(10));
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 1000);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, POLLIN, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* Level-triggered, still reported until data is read */
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+
+	res = recv(s_sock, buf, sizeof(buf), 0);
+	zassert_equal(res, sizeof(TEST_STR_SMALL) - 1, "");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* Writable UDP socket is reported right away */
+	epoll_add(epfd, c_sock, POLLOUT);
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, POLLOUT, "");
+	zassert_equal(events[0].data.fd, c_sock, "");
+
+	/* Removed sockets are not reported anymore */
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, c_sock, NULL);
+	zassert_equal(res, 0, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, c_sock, NULL);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	res = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(res, sizeof(TEST_STR_SMALL) - 1, "");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	/* Closing a socket removes it from the set */
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_epoll_tcp)
+{
+	struct zsock_epoll_event events[2];
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	char buf[10];
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	int epfd;
+	int res;
+
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = listen(s_sock, 0);
+	zassert_equal(res, 0, "listen failed");
+
+	epfd = zsock_epoll_create();
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	epoll_add(epfd, s_sock, POLLIN);
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* Incoming connection makes the listening socket readable */
+	res = connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 1000);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, POLLIN, "");
+	zassert_equal(events[0].data.fd, s_sock, "");
+
+	new_sock = accept(s_sock, NULL, NULL);
+	zassert_true(new_sock >= 0, "accept failed");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "");
+
+	epoll_add(epfd, new_sock, POLLIN);
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	/* Switch to POLLOUT, connected socket is writable */
+	events[0].events = POLLOUT;
+	events[0].data.fd = new_sock;
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_MOD, new_sock, &events[0]);
+	zassert_equal(res, 0, "");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, POLLOUT, "");
+
+	events[0].events = POLLIN;
+	events[0].data.fd = new_sock;
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_MOD, new_sock, &events[0]);
+	zassert_equal(res, 0, "");
+
+	res = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(res, sizeof(TEST_STR_SMALL) - 1, "");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_equal(events[0].events, POLLIN, "");
+	zassert_equal(events[0].data.fd, new_sock, "");
+
+	res = recv(new_sock, buf, sizeof(buf), 0);
+	zassert_equal(res, sizeof(TEST_STR_SMALL) - 1, "");
+
+	/* Peer closing the connection is reported as readable EOF */
+	res = close(c_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 100);
+	zassert_equal(res, 1, "");
+	zassert_true(events[0].events & POLLIN, "");
+
+	res = recv(new_sock, buf, sizeof(buf), 0);
+	zassert_equal(res, 0, "");
+
+	res = close(new_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = close(s_sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+}
+
+ZTEST(net_socket_epoll, test_epoll_close)
+{
+	struct zsock_epoll_event events[1];
+	struct sockaddr_in6 addr;
+	int old_sock;
+	int sock;
+	int epfd;
+	int res;
+
+	epfd = zsock_epoll_create();
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &sock, &addr);
+	epoll_add(epfd, sock, POLLOUT);
+
+	res = close(sock);
+	zassert_equal(res, 0, "close failed");
+
+	/* A new socket reusing the descriptor is not registered */
+	old_sock = sock;
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &sock, &addr);
+	zassert_equal(sock, old_sock, "descriptor not reused");
+
+	res = zsock_epoll_wait(epfd, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, 0, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_DEL, sock, NULL);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, ENOENT, "");
+
+	epoll_add(epfd, sock, POLLOUT);
+
+	res = close(sock);
+	zassert_equal(res, 0, "close failed");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST(net_socket_epoll, test_epoll_invalid)
+{
+	struct zsock_epoll_event events[1] = { 0 };
+	int epfd;
+	int res;
+
+	res = zsock_epoll_wait(-1, events, ARRAY_SIZE(events), 0);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EBADF, "");
+
+	epfd = zsock_epoll_create();
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	res = zsock_epoll_wait(epfd, events, 0, 0);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, epfd, &events[0]);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EINVAL, "");
+
+	res = zsock_epoll_ctl(epfd, ZSOCK_EPOLL_CTL_ADD, 100, &events[0]);
+	zassert_equal(res, -1, "");
+	zassert_equal(errno, EBADF, "");
+
+	res = close(epfd);
+	zassert_equal(res, 0, "close failed");
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, NULL, NULL, NULL, NULL);
@@ -11,9 +11,12 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <fcntl.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/loopback.h>
+#include <zephyr/sys/fdtable.h>
 
 #include "../../socket_helpers.h"
 
+#include "tcp_private.h"
+
 #define TEST_STR_SMALL "test"
 
 #define MY_IPV4_ADDR "127.0.0.1"
@@ -1793,6 +1796,251 @@ ZTEST(net_socket_tcp, test_v6_msg_waitall)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_v4_recv_zerocopy)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct iovec iov[4];
+	struct zsock_zc_rx rx = {
+		.iov = iov,
+		.iovlen = ARRAY_SIZE(iov),
+	};
+	uint8_t rx_buf[sizeof(TEST_STR_SMALL) - 1];
+	size_t offset = 0;
+	ssize_t ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_SOCKETS_RECV_ZEROCOPY);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	while (offset < sizeof(rx_buf)) {
+		ret = zsock_recv_zc(new_sock, &rx, 0);
+		zassert_true(ret > 0, "zsock_recv_zc failed (%d)", errno);
+		zassert_equal(ret, rx.len, "wrong loan length");
+		zassert_true(rx.iovcnt > 0 && rx.iovcnt <= rx.iovlen,
+			     "wrong fragment count");
+
+		for (size_t i = 0; i < rx.iovcnt; i++) {
+			zassert_true(offset + iov[i].iov_len <= sizeof(rx_buf),
+				     "too much data lent");
+			memcpy(rx_buf + offset, iov[i].iov_base, iov[i].iov_len);
+			offset += iov[i].iov_len;
+		}
+
+		zassert_equal(zsock_recv_zc_release(new_sock, &rx), 0,
+			      "zsock_recv_zc_release failed");
+	}
+
+	zassert_mem_equal(rx_buf, TEST_STR_SMALL, sizeof(rx_buf),
+			  "Invalid data received");
+
+	/* Nothing pending, non-blocking loan shall fail */
+	ret = zsock_recv_zc(new_sock, &rx, MSG_DONTWAIT);
+	zassert_equal(ret, -1, "zsock_recv_zc should fail");
+	zassert_equal(errno, EAGAIN, "wrong errno (%d)", errno);
+
+	/* Releasing twice is an error */
+	zassert_equal(zsock_recv_zc_release(new_sock, &rx), -1,
+		      "double release should fail");
+
+	/* Keep a loan over the close of the socket */
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+	ret = zsock_recv_zc(new_sock, &rx, 0);
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "zsock_recv_zc failed (%d)",
+		      errno);
+
+	test_close(c_sock);
+	test_eof(new_sock);
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	/* Returning the loan of a closed socket succeeds without touching
+	 * errno
+	 */
+	errno = 0;
+	zassert_equal(zsock_recv_zc_release(new_sock, &rx), 0,
+		      "zsock_recv_zc_release failed");
+	zassert_equal(errno, 0, "errno changed (%d)", errno);
+
+	test_context_cleanup();
+}
+
+struct test_zc_wakeup_data {
+	struct k_work_delayable work;
+	struct net_context *ctx;
+	int sock;
+};
+
+/* Wake the receiver up without data first, then send the data */
+static void test_zc_wakeup_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct test_zc_wakeup_data *test_data =
+		CONTAINER_OF(dwork, struct test_zc_wakeup_data, work);
+
+	if (test_data->ctx != NULL) {
+		k_condvar_broadcast(&test_data->ctx->cond.recv);
+		test_data->ctx = NULL;
+		k_work_reschedule(&test_data->work, K_MSEC(10));
+	} else {
+		test_send(test_data->sock, TEST_STR_SMALL,
+			  strlen(TEST_STR_SMALL), 0);
+	}
+}
+
+ZTEST(net_socket_tcp, test_v4_recv_zerocopy_wakeup)
+{
+	struct test_zc_wakeup_data test_data = { 0 };
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct iovec iov[4];
+	struct zsock_zc_rx rx = {
+		.iov = iov,
+		.iovlen = ARRAY_SIZE(iov),
+	};
+	struct timeval optval = {
+		.tv_sec = 1,
+		.tv_usec = 0,
+	};
+	ssize_t ret;
+	int rv;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_SOCKETS_RECV_ZEROCOPY);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	rv = setsockopt(new_sock, SOL_SOCKET, SO_RCVTIMEO, &optval,
+			sizeof(optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	/* A wakeup without data does not end the wait before the timeout */
+	test_data.ctx = z_get_fd_obj(new_sock, NULL, 0);
+	test_data.sock = c_sock;
+	k_work_init_delayable(&test_data.work, test_zc_wakeup_work_handler);
+	k_work_reschedule(&test_data.work, K_MSEC(10));
+
+	ret = zsock_recv_zc(new_sock, &rx, 0);
+	zassert_true(ret > 0, "zsock_recv_zc failed (%d)", errno);
+	zassert_equal(zsock_recv_zc_release(new_sock, &rx), 0,
+		      "zsock_recv_zc_release failed");
+	k_work_cancel_delayable(&test_data.work);
+
+	test_close(new_sock);
+	test_close(s_sock);
+	test_close(c_sock);
+
+	test_context_cleanup();
+}
+
+ZTEST(net_socket_tcp, test_v4_recv_zerocopy_reuse)
+{
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct iovec iov[4];
+	struct zsock_zc_rx rx = {
+		.iov = iov,
+		.iovlen = ARRAY_SIZE(iov),
+	};
+	char peek_buf[1];
+	struct net_context *ctx;
+	struct tcp *conn;
+	uint16_t recv_win;
+	ssize_t ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_SOCKETS_RECV_ZEROCOPY);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	/* Keep a loan until the context is used by another connection */
+	ret = zsock_recv_zc(new_sock, &rx, 0);
+	zassert_true(ret > 0, "zsock_recv_zc failed (%d)", errno);
+
+	test_close(c_sock);
+	test_eof(new_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	ctx = z_get_fd_obj(new_sock, NULL, 0);
+	zassert_equal_ptr(ctx, rx.ctx, "context not reused");
+
+	/* Wait for the data, which closes the receive window */
+	ret = recv(new_sock, peek_buf, sizeof(peek_buf), MSG_PEEK);
+	zassert_equal(ret, sizeof(peek_buf), "recv failed (%d)", errno);
+
+	conn = ctx->tcp;
+	recv_win = conn->recv_win;
+
+	/* The old loan must not reopen the window of the new connection */
+	zassert_equal(zsock_recv_zc_release(new_sock, &rx), 0,
+		      "zsock_recv_zc_release failed");
+	zassert_equal(conn->recv_win, recv_win, "receive window changed");
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+
 #ifdef CONFIG_USERSPACE
 #define CHILD_STACK_SZ		(2048 + CONFIG_TEST_EXTRA_STACK_SIZE)
 struct k_thread child_thread;
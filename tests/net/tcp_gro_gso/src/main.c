@@ -0,0 +1,410 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/socket.h>
+
+#include "net_private.h"
+#include "net_stats.h"
+#include "tcp_internal.h"
+
+#define PEER_PORT 4242
+#define PEER_MSS 500
+#define PEER_WINDOW 8192
+#define PEER_ISN 1000
+
+#define ETH_HDR_LEN sizeof(struct net_eth_hdr)
+#define TCP_HDR_LEN sizeof(struct tcphdr)
+#define MSS_OPT_LEN 4
+
+#define DATA_LEN (4 * PEER_MSS)
+/* Queued by one send call, which is limited to the interface MTU */
+#define SEND_LEN 1400
+#define SEG_COUNT 16
+
+static struct net_if *eth_iface;
+static int sock = -1;
+
+static uint8_t my_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+static uint8_t peer_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 };
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+/* TCP state of the emulated peer */
+static struct {
+	uint16_t port;
+	uint32_t seq;
+	uint32_t ack;
+} peer;
+
+struct seg_info {
+	uint32_t seq;
+	uint16_t len;
+	uint16_t ip_id;
+	uint8_t flags;
+	bool chksum_ok;
+};
+
+/* Data segments sent by the stack */
+static struct seg_info segs[SEG_COUNT];
+static int seg_count;
+static uint8_t peer_data[DATA_LEN];
+static size_t peer_data_len;
+static K_SEM_DEFINE(peer_data_sem, 0, UINT_MAX);
+
+static uint8_t test_data[DATA_LEN];
+
+/* Emulate a bit error on the wire in the next packet from the peer */
+static bool corrupt_next;
+
+static uint16_t chksum(uint32_t sum, const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i + 1 < len; i += 2) {
+		sum += sys_get_be16(&data[i]);
+	}
+
+	if (len & 1) {
+		sum += data[len - 1] << 8;
+	}
+
+	while (sum >> 16) {
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	return sum;
+}
+
+static uint16_t tcp_chksum(const uint8_t *ip, const uint8_t *tcp, size_t tcp_len)
+{
+	uint16_t sum;
+
+	/* Pseudo header: addresses, protocol and TCP length */
+	sum = chksum(IPPROTO_TCP + tcp_len, ip + 12, 2 * NET_IPV4_ADDR_SIZE);
+
+	return chksum(sum, tcp, tcp_len);
+}
+
+static void peer_send(uint8_t flags, const uint8_t *data, size_t len)
+{
+	uint8_t frame[ETH_HDR_LEN + NET_IPV4H_LEN + TCP_HDR_LEN + MSS_OPT_LEN +
+		      PEER_MSS];
+	uint8_t *ip = frame + ETH_HDR_LEN;
+	uint8_t *tcp = ip + NET_IPV4H_LEN;
+	size_t tcp_hdr_len = TCP_HDR_LEN + ((flags & SYN) ? MSS_OPT_LEN : 0);
+	size_t frame_len = ETH_HDR_LEN + NET_IPV4H_LEN + tcp_hdr_len + len;
+	struct net_pkt *pkt;
+
+	memset(frame, 0, sizeof(frame));
+
+	memcpy(frame, my_mac, sizeof(my_mac));
+	memcpy(frame + sizeof(my_mac), peer_mac, sizeof(peer_mac));
+	sys_put_be16(NET_ETH_PTYPE_IP, frame + 2 * sizeof(my_mac));
+
+	ip[0] = 0x45;
+	sys_put_be16(NET_IPV4H_LEN + tcp_hdr_len + len, ip + 2);
+	ip[8] = 64;
+	ip[9] = IPPROTO_TCP;
+	memcpy(ip + 12, &peer_addr, sizeof(peer_addr));
+	memcpy(ip + 16, &my_addr, sizeof(my_addr));
+	sys_put_be16(~chksum(0, ip, NET_IPV4H_LEN), ip + 10);
+
+	sys_put_be16(PEER_PORT, tcp);
+	sys_put_be16(peer.port, tcp + 2);
+	sys_put_be32(peer.seq, tcp + 4);
+	sys_put_be32(peer.ack, tcp + 8);
+	tcp[12] = (tcp_hdr_len / 4) << 4;
+	tcp[13] = flags;
+	sys_put_be16(PEER_WINDOW, tcp + 14);
+
+	if (flags & SYN) {
+		tcp[20] = NET_TCP_MSS_OPT;
+		tcp[21] = NET_TCP_MSS_SIZE;
+		sys_put_be16(PEER_MSS, tcp + 22);
+	}
+
+	memcpy(tcp + tcp_hdr_len, data, len);
+	sys_put_be16(~tcp_chksum(ip, tcp, tcp_hdr_len + len), tcp + 16);
+
+	if (corrupt_next && len > 0) {
+		tcp[tcp_hdr_len] ^= 0x01;
+		corrupt_next = false;
+	}
+
+	peer.seq += len + ((flags & SYN) ? 1 : 0);
+
+	pkt = net_pkt_rx_alloc_with_buffer(eth_iface, frame_len, AF_UNSPEC, 0,
+					   K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	zassert_equal(net_pkt_write(pkt, frame, frame_len), 0, "Write failed");
+	zassert_equal(net_recv_data(eth_iface, pkt), 0, "Recv failed");
+}
+
+static void peer_recv(const uint8_t *ip)
+{
+	size_t ip_len = (ip[0] & 0x0f) * 4U;
+	size_t tcp_len = sys_get_be16(ip + 2) - ip_len;
+	const uint8_t *tcp = ip + ip_len;
+	size_t tcp_hdr_len = (tcp[12] >> 4) * 4U;
+	size_t len = tcp_len - tcp_hdr_len;
+	uint32_t seq = sys_get_be32(tcp + 4);
+	uint8_t flags = tcp[13];
+
+	if (flags & SYN) {
+		peer.port = sys_get_be16(tcp);
+		peer.seq = PEER_ISN;
+		peer.ack = seq + 1;
+
+		peer_send(SYN | ACK, NULL, 0);
+		return;
+	}
+
+	if (len == 0) {
+		return;
+	}
+
+	if (seg_count < SEG_COUNT) {
+		segs[seg_count].seq = seq;
+		segs[seg_count].len = len;
+		segs[seg_count].ip_id = sys_get_be16(ip + 4);
+		segs[seg_count].flags = flags;
+		segs[seg_count].chksum_ok =
+			chksum(0, ip, ip_len) == 0xffff &&
+			tcp_chksum(ip, tcp, tcp_len) == 0xffff;
+		seg_count++;
+	}
+
+	if (seq == peer.ack && peer_data_len + len <= sizeof(peer_data)) {
+		memcpy(peer_data + peer_data_len, tcp + tcp_hdr_len, len);
+		peer_data_len += len;
+		peer.ack += len;
+	}
+
+	peer_send(ACK, NULL, 0);
+
+	k_sem_give(&peer_data_sem);
+}
+
+static void eth_fake_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, my_mac, sizeof(my_mac), NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_fake_send(const struct device *dev, struct net_pkt *pkt)
+{
+	static uint8_t frame[ETH_HDR_LEN + NET_ETH_MTU];
+	size_t len = net_pkt_get_len(pkt);
+
+	ARG_UNUSED(dev);
+
+	/* Frames larger than the MTU would not fit on the wire */
+	if (len > sizeof(frame)) {
+		return -EMSGSIZE;
+	}
+
+	net_pkt_cursor_init(pkt);
+	if (net_pkt_read(pkt, frame, len) < 0) {
+		return -EIO;
+	}
+
+	if (sys_get_be16(frame + 2 * sizeof(my_mac)) == NET_ETH_PTYPE_IP &&
+	    frame[ETH_HDR_LEN + 9] == IPPROTO_TCP) {
+		peer_recv(frame + ETH_HDR_LEN);
+	}
+
+	return 0;
+}
+
+static struct ethernet_api eth_fake_api_funcs = {
+	.iface_api.init = eth_fake_iface_init,
+	.send = eth_fake_send,
+};
+
+ETH_NET_DEVICE_INIT(eth_fake, "eth_fake", NULL, NULL, NULL, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &eth_fake_api_funcs, NET_ETH_MTU);
+
+static void *gro_gso_setup(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(PEER_PORT),
+		.sin_addr = peer_addr,
+	};
+	struct in_addr netmask = { { { 255, 255, 255, 0 } } };
+	int ret;
+
+	for (int i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = i * 7 + 3;
+	}
+
+	eth_iface = net_if_get_first_by_type(&NET_L2_GET_NAME(ETHERNET));
+	zassert_not_null(eth_iface, "No Ethernet interface");
+
+	zassert_not_null(net_if_ipv4_addr_add(eth_iface, &my_addr,
+					      NET_ADDR_MANUAL, 0),
+			 "Cannot add address");
+	net_if_ipv4_set_netmask(eth_iface, &netmask);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(sock >= 0, "Cannot create socket (%d)", errno);
+
+	ret = zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr));
+	zassert_equal(ret, 0, "Cannot connect (%d)", errno);
+
+	return NULL;
+}
+
+static void gro_gso_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	seg_count = 0;
+	peer_data_len = 0;
+	k_sem_reset(&peer_data_sem);
+}
+
+static void recv_all(size_t len)
+{
+	static uint8_t buf[DATA_LEN];
+	size_t received = 0;
+
+	while (received < len) {
+		ssize_t ret;
+
+		ret = zsock_recv(sock, buf + received, len - received, 0);
+		zassert_true(ret > 0, "recv failed (%d)", errno);
+
+		received += ret;
+	}
+
+	zassert_mem_equal(buf, test_data, len, "Invalid data received");
+}
+
+ZTEST(net_tcp_gro_gso, test_send)
+{
+	uint32_t seq = peer.ack;
+	ssize_t ret;
+
+	ret = zsock_send(sock, test_data, SEND_LEN, 0);
+	zassert_equal(ret, SEND_LEN, "send failed (%d)", errno);
+
+	while (peer_data_len < SEND_LEN) {
+		zassert_equal(k_sem_take(&peer_data_sem, K_SECONDS(1)), 0,
+			      "Only %zu bytes sent", peer_data_len);
+	}
+
+	zassert_mem_equal(peer_data, test_data, SEND_LEN, "Invalid data sent");
+	zassert_true(seg_count >= DIV_ROUND_UP(SEND_LEN, PEER_MSS),
+		     "Too few segments");
+
+	for (int i = 0; i < seg_count; i++) {
+		zassert_equal(segs[i].seq, seq, "Segment %d out of order", i);
+		zassert_true(segs[i].len <= PEER_MSS, "Segment %d too large", i);
+		zassert_true(segs[i].chksum_ok, "Segment %d bad checksum", i);
+
+		/* Data sent as one packet is pushed only at its end */
+		if (IS_ENABLED(CONFIG_NET_TCP_GSO) && i < seg_count - 1) {
+			zassert_false(segs[i].flags & PSH, "Segment %d pushed", i);
+		}
+
+		/* Segments split from one packet are distinct datagrams */
+		if (IS_ENABLED(CONFIG_NET_TCP_GSO) && i > 0) {
+			zassert_equal(segs[i].ip_id, (uint16_t)(segs[i - 1].ip_id + 1),
+				      "Segment %d has IPv4 ID %u", i, segs[i].ip_id);
+		}
+
+		seq += segs[i].len;
+	}
+
+	zassert_true(segs[seg_count - 1].flags & PSH, "Last segment not pushed");
+}
+
+ZTEST(net_tcp_gro_gso, test_recv_in_order)
+{
+	net_stats_t ipv4_recv = GET_STAT(eth_iface, ipv4.recv);
+
+	/* Queue all segments before the RX thread gets to run */
+	k_sched_lock();
+
+	for (int i = 0; i < 4; i++) {
+		peer_send(ACK | (i == 3 ? PSH : 0), test_data + i * PEER_MSS,
+			  PEER_MSS);
+	}
+
+	k_sched_unlock();
+
+	recv_all(4 * PEER_MSS);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_GRO)) {
+		zassert_equal(GET_STAT(eth_iface, ipv4.recv) - ipv4_recv, 1,
+			      "Segments not merged");
+	}
+}
+
+ZTEST(net_tcp_gro_gso, test_recv_out_of_order)
+{
+	static const int order[] = { 0, 1, 3, 2 };
+	uint32_t seq = peer.seq;
+
+	k_sched_lock();
+
+	for (int i = 0; i < ARRAY_SIZE(order); i++) {
+		peer.seq = seq + order[i] * PEER_MSS;
+		peer_send(ACK, test_data + order[i] * PEER_MSS, PEER_MSS);
+	}
+
+	k_sched_unlock();
+
+	peer.seq = seq + ARRAY_SIZE(order) * PEER_MSS;
+
+	recv_all(ARRAY_SIZE(order) * PEER_MSS);
+}
+
+ZTEST(net_tcp_gro_gso, test_recv_corrupted)
+{
+	net_stats_t chkerr = GET_STAT(eth_iface, tcp.chkerr);
+	uint32_t seq = peer.seq;
+
+	k_sched_lock();
+
+	peer_send(ACK, test_data, PEER_MSS);
+
+	corrupt_next = true;
+	peer_send(ACK, test_data + PEER_MSS, PEER_MSS);
+
+	k_sched_unlock();
+
+	k_sleep(K_MSEC(100));
+
+	zassert_true(GET_STAT(eth_iface, tcp.chkerr) > chkerr,
+		     "Corrupted data not detected");
+
+	/* Resend everything */
+	peer.seq = seq;
+
+	k_sched_lock();
+
+	peer_send(ACK, test_data, PEER_MSS);
+	peer_send(ACK | PSH, test_data + PEER_MSS, PEER_MSS);
+
+	k_sched_unlock();
+
+	recv_all(2 * PEER_MSS);
+}
+
+ZTEST_SUITE(net_tcp_gro_gso, NULL, gro_gso_setup, gro_gso_before, NULL, NULL);
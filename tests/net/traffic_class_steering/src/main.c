@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2026 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_TC_LOG_LEVEL);
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/ppp.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+
+#define FLOW_COUNT 64
+
+static struct net_if *eth_iface;
+static struct net_if *dummy_iface;
+static struct net_if *ppp_iface;
+
+static uint8_t src_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+static uint8_t dst_mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x02 };
+
+static void eth_fake_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, src_mac, sizeof(src_mac), NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_fake_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct ethernet_api eth_fake_api_funcs = {
+	.iface_api.init = eth_fake_iface_init,
+	.send = eth_fake_send,
+};
+
+ETH_NET_DEVICE_INIT(eth_fake, "eth_fake", NULL, NULL, NULL, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &eth_fake_api_funcs, NET_ETH_MTU);
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, dst_mac, sizeof(dst_mac), NET_LINK_DUMMY);
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct dummy_api dummy_api_funcs = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(dummy_test, "dummy_test", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api_funcs,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+static void ppp_fake_iface_init(struct net_if *iface)
+{
+	/* Keep the link down, only the L2 type matters */
+	net_if_flag_set(iface, NET_IF_NO_AUTO_START);
+}
+
+static int ppp_fake_start(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 0;
+}
+
+static int ppp_fake_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct ppp_api ppp_fake_api_funcs = {
+	.iface_api.init = ppp_fake_iface_init,
+	.start = ppp_fake_start,
+	.stop = ppp_fake_start,
+	.send = ppp_fake_send,
+};
+
+NET_DEVICE_INIT(ppp_fake, "ppp_fake", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &ppp_fake_api_funcs,
+		PPP_L2, NET_L2_GET_CTX_TYPE(PPP_L2), NET_ETH_MTU);
+
+struct flow {
+	sa_family_t family;
+	uint16_t src_port;
+	uint16_t dst_port;
+	uint8_t proto;
+};
+
+#define FRAG_NONE  0
+#define FRAG_FIRST 1
+#define FRAG_NEXT  2
+
+static void write_l2(struct net_pkt *pkt, uint16_t type, bool vlan)
+{
+	net_pkt_write(pkt, dst_mac, sizeof(dst_mac));
+	net_pkt_write(pkt, src_mac, sizeof(src_mac));
+
+	if (vlan) {
+		net_pkt_write_be16(pkt, NET_ETH_PTYPE_VLAN);
+		net_pkt_write_be16(pkt, 100);
+	}
+
+	net_pkt_write_be16(pkt, type);
+}
+
+static struct net_pkt *build_pkt(struct net_if *iface, const struct flow *flow,
+				 bool vlan, int frag)
+{
+	static const uint8_t addr4[2][NET_IPV4_ADDR_SIZE] = {
+		{ 192, 0, 2, 1 }, { 192, 0, 2, 2 },
+	};
+	static const uint8_t addr6[2][NET_IPV6_ADDR_SIZE] = {
+		{ 0x20, 0x01, 0x0d, 0xb8, [15] = 1 },
+		{ 0x20, 0x01, 0x0d, 0xb8, [15] = 2 },
+	};
+	bool eth = net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET);
+	bool ppp = net_if_l2(iface) == &NET_L2_GET_NAME(PPP);
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_with_buffer(iface, 128, AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	if (flow->family == AF_INET) {
+		uint16_t offset = 0;
+
+		if (frag == FRAG_FIRST) {
+			offset = BIT(13);
+		} else if (frag == FRAG_NEXT) {
+			offset = 3;
+		}
+
+		if (eth) {
+			write_l2(pkt, NET_ETH_PTYPE_IP, vlan);
+		} else if (ppp) {
+			net_pkt_write_be16(pkt, PPP_IP);
+		}
+
+		net_pkt_write_u8(pkt, 0x45);
+		net_pkt_write_u8(pkt, 0);
+		net_pkt_write_be16(pkt, 28);
+		net_pkt_write_be16(pkt, 0);
+		net_pkt_write_be16(pkt, offset);
+		net_pkt_write_u8(pkt, 64);
+		net_pkt_write_u8(pkt, flow->proto);
+		net_pkt_write_be16(pkt, 0);
+		net_pkt_write(pkt, addr4[0], sizeof(addr4[0]));
+		net_pkt_write(pkt, addr4[1], sizeof(addr4[1]));
+	} else if (flow->family == AF_INET6) {
+		if (eth) {
+			write_l2(pkt, NET_ETH_PTYPE_IPV6, vlan);
+		} else if (ppp) {
+			net_pkt_write_be16(pkt, PPP_IPV6);
+		}
+
+		net_pkt_write_be32(pkt, 0x60000000);
+		net_pkt_write_be16(pkt, 8);
+		net_pkt_write_u8(pkt, flow->proto);
+		net_pkt_write_u8(pkt, 64);
+		net_pkt_write(pkt, addr6[0], sizeof(addr6[0]));
+		net_pkt_write(pkt, addr6[1], sizeof(addr6[1]));
+	} else if (ppp) {
+		net_pkt_write_be16(pkt, PPP_LCP);
+	} else {
+		write_l2(pkt, NET_ETH_PTYPE_ARP, vlan);
+	}
+
+	if (frag == FRAG_NEXT) {
+		/* Payload of a later fragment, looks like different ports */
+		net_pkt_write_be16(pkt, flow->src_port + 1);
+		net_pkt_write_be16(pkt, flow->dst_port + 1);
+	} else {
+		net_pkt_write_be16(pkt, flow->src_port);
+		net_pkt_write_be16(pkt, flow->dst_port);
+	}
+
+	net_pkt_write_be16(pkt, 8);
+	net_pkt_write_be16(pkt, 0);
+
+	net_pkt_set_overwrite(pkt, true);
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+
+static uint8_t steer(struct net_if *iface, const struct flow *flow, bool vlan,
+		     int frag)
+{
+	struct net_pkt *pkt = build_pkt(iface, flow, vlan, frag);
+	uint8_t queue;
+
+	queue = net_tc_rx_flow_steer(iface, pkt);
+	zassert_true(queue < NET_TC_RX_COUNT, "Invalid queue %d", queue);
+
+	/* Steering must not consume any data */
+	zassert_equal(net_pkt_get_current_offset(pkt), 0, "Cursor moved");
+
+	net_pkt_unref(pkt);
+
+	return queue;
+}
+
+static void *steering_setup(void)
+{
+	eth_iface = net_if_get_first_by_type(&NET_L2_GET_NAME(ETHERNET));
+	zassert_not_null(eth_iface, "No Ethernet interface");
+
+	dummy_iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(dummy_iface, "No dummy interface");
+
+	ppp_iface = net_if_get_first_by_type(&NET_L2_GET_NAME(PPP));
+	zassert_not_null(ppp_iface, "No PPP interface");
+
+	return NULL;
+}
+
+ZTEST(net_tc_steering, test_same_flow_same_queue)
+{
+	static const sa_family_t families[] = { AF_INET, AF_INET6 };
+
+	for (int i = 0; i < ARRAY_SIZE(families); i++) {
+		struct flow flow = {
+			.family = families[i],
+			.proto = IPPROTO_UDP,
+			.dst_port = 5683,
+		};
+
+		for (int j = 0; j < FLOW_COUNT; j++) {
+			uint8_t queue;
+
+			flow.src_port = 49152 + j;
+
+			queue = steer(eth_iface, &flow, false, FRAG_NONE);
+
+			zassert_equal(steer(eth_iface, &flow, false, FRAG_NONE),
+				      queue, "Flow moved between queues");
+			zassert_equal(steer(eth_iface, &flow, true, FRAG_NONE),
+				      queue, "VLAN tag changed the queue");
+			zassert_equal(steer(dummy_iface, &flow, false,
+					    FRAG_NONE),
+				      queue, "L2 changed the queue");
+			zassert_equal(steer(ppp_iface, &flow, false, FRAG_NONE),
+				      queue, "PPP changed the queue");
+		}
+	}
+}
+
+ZTEST(net_tc_steering, test_flows_spread)
+{
+	static const sa_family_t families[] = { AF_INET, AF_INET6 };
+
+	for (int i = 0; i < ARRAY_SIZE(families); i++) {
+		int hits[NET_TC_RX_COUNT] = { 0 };
+		struct flow flow = {
+			.family = families[i],
+			.proto = IPPROTO_UDP,
+			.dst_port = 5683,
+		};
+
+		for (int j = 0; j < FLOW_COUNT; j++) {
+			flow.src_port = 49152 + j;
+			hits[steer(eth_iface, &flow, false, FRAG_NONE)]++;
+		}
+
+		for (int j = 0; j < NET_TC_RX_COUNT; j++) {
+			zassert_true(hits[j] > 0, "Queue %d not used", j);
+		}
+	}
+}
+
+ZTEST(net_tc_steering, test_ipv4_fragments)
+{
+	struct flow flow = {
+		.family = AF_INET,
+		.proto = IPPROTO_UDP,
+		.dst_port = 5683,
+	};
+
+	for (int j = 0; j < FLOW_COUNT; j++) {
+		flow.src_port = 49152 + j;
+
+		zassert_equal(steer(eth_iface, &flow, false, FRAG_FIRST),
+			      steer(eth_iface, &flow, false, FRAG_NEXT),
+			      "Fragments steered to different queues");
+	}
+}
+
+ZTEST(net_tc_steering, test_non_ip)
+{
+	struct flow flow = {
+		.family = AF_UNSPEC,
+	};
+
+	for (int j = 0; j < FLOW_COUNT; j++) {
+		flow.src_port = j;
+
+		zassert_equal(steer(eth_iface, &flow, false, FRAG_NONE), 0,
+			      "Non-IP packet not on the first queue");
+		zassert_equal(steer(ppp_iface, &flow, false, FRAG_NONE), 0,
+			      "Non-IP PPP packet not on the first queue");
+	}
+}
+
+ZTEST_SUITE(net_tc_steering, NULL, steering_setup, NULL, NULL, NULL);